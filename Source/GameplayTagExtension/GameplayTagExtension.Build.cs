@@ -27,7 +27,8 @@ public class GameplayTagExtension : ModuleRules
 			{
 				"Core",
 				"Engine",
-				"GameplayTags"
+				"GameplayTags",
+				"EnhancedInput"
 			});
 			
 		
@@ -35,7 +36,6 @@ public class GameplayTagExtension : ModuleRules
 			new string[]
 			{
 				"CoreUObject",
-				"EnhancedInput",
 			}
 			);
 		
@@ -0,0 +1,233 @@
+// Copyright 2025 Nguyen Phi Hung. All Rights Reserved.
+
+#include "UnifyGameplayTagEventRecorder.h"
+#include "UnifyGameplayTagsInterface.h"
+#include "GameplayTagExtension.h"
+
+namespace UnifyGameplayTagEventRecorder
+{
+	static constexpr uint32 StreamMagic = 0x52544755; // 'UGTR'
+	static constexpr uint32 StreamVersion = 1;
+}
+
+FUnifyGameplayTagEventRecordWriter::FUnifyGameplayTagEventRecordWriter(TArray<uint8>& InBuffer)
+	: MemoryWriter(InBuffer)
+	, Archive(MemoryWriter, false)
+{
+	Archive.SetWantBinaryPropertySerialization(true);
+
+	uint32 Magic = UnifyGameplayTagEventRecorder::StreamMagic;
+	uint32 Version = UnifyGameplayTagEventRecorder::StreamVersion;
+	Archive << Magic;
+	Archive << Version;
+}
+
+void FUnifyGameplayTagEventRecordWriter::WriteEvent(uint32 Frame, const FGameplayTag& EventTag, const UObject* Dispatcher, const FGameplayTagMessageData& Data, const FGameplayTagContainer& PayloadTags)
+{
+	// Frames only ever grow during a recording, store the delta to keep it to a single byte most of the time
+	uint32 FrameDelta = Frame - LastFrame;
+	Archive.SerializeIntPacked(FrameDelta);
+	LastFrame = Frame;
+
+	WriteTableEntry(Archive, EventTag.GetTagName().ToString());
+	WriteTableEntry(Archive, Dispatcher ? Dispatcher->GetPathName() : FString());
+	WriteTableEntry(Archive, Data.SourceObject ? Data.SourceObject->GetPathName() : FString());
+
+	const UScriptStruct* PayloadStruct = Data.Payload.GetScriptStruct();
+	WriteTableEntry(Archive, PayloadStruct ? PayloadStruct->GetPathName() : FString());
+	if (PayloadStruct)
+	{
+		PayloadScratch.Reset();
+		FMemoryWriter PayloadWriter(PayloadScratch);
+		FObjectAndNameAsStringProxyArchive PayloadArchive(PayloadWriter, false);
+		PayloadArchive.SetWantBinaryPropertySerialization(true);
+		const_cast<UScriptStruct*>(PayloadStruct)->SerializeItem(PayloadArchive, const_cast<uint8*>(Data.Payload.GetMemory()), nullptr);
+
+		uint32 PayloadSize = PayloadScratch.Num();
+		Archive.SerializeIntPacked(PayloadSize);
+		Archive.Serialize(PayloadScratch.GetData(), PayloadSize);
+	}
+
+	WriteTags(Archive, Data.Tags);
+	WriteTags(Archive, PayloadTags);
+
+	++NumRecords;
+}
+
+void FUnifyGameplayTagEventRecordWriter::WriteTableEntry(FArchive& Ar, const FString& Value)
+{
+	// 0 means empty, otherwise the 1-based index in the string table.
+	// The first occurrence of a string is followed by the string itself.
+	if (Value.IsEmpty())
+	{
+		uint32 Index = 0;
+		Ar.SerializeIntPacked(Index);
+		return;
+	}
+
+	if (const uint32* ExistingIndex = StringTable.Find(Value))
+	{
+		uint32 Index = *ExistingIndex;
+		Ar.SerializeIntPacked(Index);
+		return;
+	}
+
+	uint32 Index = StringTable.Num() + 1;
+	StringTable.Add(Value, Index);
+	Ar.SerializeIntPacked(Index);
+	FString MutableValue = Value;
+	Ar << MutableValue;
+}
+
+void FUnifyGameplayTagEventRecordWriter::WriteTags(FArchive& Ar, const FGameplayTagContainer& Tags)
+{
+	uint32 NumTags = Tags.Num();
+	Ar.SerializeIntPacked(NumTags);
+	for (const FGameplayTag& Tag : Tags)
+	{
+		WriteTableEntry(Ar, Tag.GetTagName().ToString());
+	}
+}
+
+FUnifyGameplayTagEventRecordReader::FUnifyGameplayTagEventRecordReader(const TArray<uint8>& InBuffer)
+	: MemoryReader(InBuffer)
+	, Archive(MemoryReader, true)
+{
+	Archive.SetWantBinaryPropertySerialization(true);
+
+	uint32 Magic = 0;
+	uint32 Version = 0;
+	if (InBuffer.Num() >= static_cast<int32>(sizeof(uint32) * 2))
+	{
+		Archive << Magic;
+		Archive << Version;
+	}
+
+	bValid = Magic == UnifyGameplayTagEventRecorder::StreamMagic && Version == UnifyGameplayTagEventRecorder::StreamVersion;
+	if (!bValid)
+	{
+		UE_LOG(LogGameplayTagExtension, Error, TEXT("Gameplay tag event stream has an unknown header (magic %08x, version %u)."), Magic, Version);
+	}
+}
+
+bool FUnifyGameplayTagEventRecordReader::AtEnd() const
+{
+	return !bValid || MemoryReader.AtEnd();
+}
+
+bool FUnifyGameplayTagEventRecordReader::ReadNext(FUnifyGameplayTagEventRecord& OutRecord)
+{
+	if (AtEnd())
+	{
+		return false;
+	}
+
+	uint32 FrameDelta = 0;
+	Archive.SerializeIntPacked(FrameDelta);
+	LastFrame += FrameDelta;
+	OutRecord.Frame = LastFrame;
+
+	FString EventTagName;
+	FString DispatcherPath;
+	FString SourceObjectPath;
+	FString PayloadStructPath;
+	if (!ReadTableEntry(Archive, EventTagName)
+		|| !ReadTableEntry(Archive, DispatcherPath)
+		|| !ReadTableEntry(Archive, SourceObjectPath)
+		|| !ReadTableEntry(Archive, PayloadStructPath))
+	{
+		bValid = false;
+		return false;
+	}
+
+	OutRecord.EventTag = FGameplayTag::RequestGameplayTag(FName(*EventTagName), false);
+	OutRecord.DispatcherPath = FSoftObjectPath(DispatcherPath);
+	OutRecord.SourceObjectPath = FSoftObjectPath(SourceObjectPath);
+	OutRecord.Payload.Reset();
+
+	if (!PayloadStructPath.IsEmpty())
+	{
+		uint32 PayloadSize = 0;
+		Archive.SerializeIntPacked(PayloadSize);
+		if (MemoryReader.Tell() + PayloadSize > MemoryReader.TotalSize())
+		{
+			bValid = false;
+			return false;
+		}
+
+		if (const UScriptStruct* PayloadStruct = Cast<UScriptStruct>(FSoftObjectPath(PayloadStructPath).TryLoad()))
+		{
+			PayloadScratch.SetNumUninitialized(PayloadSize);
+			Archive.Serialize(PayloadScratch.GetData(), PayloadSize);
+
+			FMemoryReader PayloadReader(PayloadScratch);
+			FObjectAndNameAsStringProxyArchive PayloadArchive(PayloadReader, true);
+			PayloadArchive.SetWantBinaryPropertySerialization(true);
+			OutRecord.Payload.InitializeAs(PayloadStruct);
+			const_cast<UScriptStruct*>(PayloadStruct)->SerializeItem(PayloadArchive, OutRecord.Payload.GetMutableMemory(), nullptr);
+		}
+		else
+		{
+			UE_LOG(LogGameplayTagExtension, Warning, TEXT("Skipping payload of recorded event [%s]: struct [%s] could not be found."), *EventTagName, *PayloadStructPath);
+			MemoryReader.Seek(MemoryReader.Tell() + PayloadSize);
+		}
+	}
+
+	if (!ReadTags(Archive, OutRecord.MessageTags) || !ReadTags(Archive, OutRecord.PayloadTags))
+	{
+		bValid = false;
+		return false;
+	}
+
+	if (Archive.IsError())
+	{
+		// A truncated or corrupt stream must not be read any further
+		bValid = false;
+		return false;
+	}
+	return true;
+}
+
+bool FUnifyGameplayTagEventRecordReader::ReadTableEntry(FArchive& Ar, FString& OutValue)
+{
+	uint32 Index = 0;
+	Ar.SerializeIntPacked(Index);
+	if (Index == 0)
+	{
+		OutValue.Reset();
+		return true;
+	}
+
+	if (Index == static_cast<uint32>(StringTable.Num()) + 1)
+	{
+		Ar << OutValue;
+		StringTable.Add(OutValue);
+		return !Ar.IsError();
+	}
+
+	if (Index <= static_cast<uint32>(StringTable.Num()))
+	{
+		OutValue = StringTable[Index - 1];
+		return true;
+	}
+
+	return false;
+}
+
+bool FUnifyGameplayTagEventRecordReader::ReadTags(FArchive& Ar, FGameplayTagContainer& OutTags)
+{
+	OutTags.Reset();
+
+	uint32 NumTags = 0;
+	Ar.SerializeIntPacked(NumTags);
+	for (uint32 TagIndex = 0; TagIndex < NumTags; ++TagIndex)
+	{
+		FString TagName;
+		if (!ReadTableEntry(Ar, TagName))
+		{
+			return false;
+		}
+		OutTags.AddTag(FGameplayTag::RequestGameplayTag(FName(*TagName), false));
+	}
+	return true;
+}
@@ -4,24 +4,115 @@
 #include "GameplayTagExtension.h"
 #include UE_INLINE_GENERATED_CPP_BY_NAME(UnifyGameplayTagInputAction)
 
+FUnifyGameplayTagInputLookup FUnifyGameplayTagInputLookup::Merge(TConstArrayView<const UUnifyGameplayTagInputConfig*> Configs)
+{
+	FUnifyGameplayTagInputLookup Result;
+	for (const UUnifyGameplayTagInputConfig* Config : Configs)
+	{
+		Result.AddConfig(Config);
+	}
+	return Result;
+}
+
+void FUnifyGameplayTagInputLookup::Reset()
+{
+	TagToAction.Reset();
+	ActionToTag.Reset();
+}
+
+void FUnifyGameplayTagInputLookup::AddConfig(const UUnifyGameplayTagInputConfig* Config)
+{
+	if (!Config)
+	{
+		return;
+	}
+
+	TagToAction.Reserve(TagToAction.Num() + Config->NativeInputActions.Num());
+	ActionToTag.Reserve(ActionToTag.Num() + Config->NativeInputActions.Num());
+	for (const FUnifyGameplayTagInputAction& Action : Config->NativeInputActions)
+	{
+		Add(Action.InputAction, Action.InputTag);
+	}
+}
+
+void FUnifyGameplayTagInputLookup::Add(const UInputAction* InputAction, const FGameplayTag& InputTag)
+{
+	// The first mapping wins, matching the order a linear scan of the configs would find them in
+	if (InputAction && InputTag.IsValid())
+	{
+		TagToAction.FindOrAdd(InputTag, InputAction);
+		ActionToTag.FindOrAdd(InputAction, InputTag);
+	}
+}
+
 UUnifyGameplayTagInputConfig::UUnifyGameplayTagInputConfig(const FObjectInitializer& ObjectInitializer)
 {
 }
 
+void UUnifyGameplayTagInputConfig::PostLoad()
+{
+	Super::PostLoad();
+
+	RebuildInputLookup();
+}
+
+#if WITH_EDITOR
+void UUnifyGameplayTagInputConfig::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	bInputLookupDirty = true;
+}
+#endif
+
+void UUnifyGameplayTagInputConfig::RebuildInputLookup()
+{
+	InputLookup.Reset();
+	InputLookup.AddConfig(this);
+	LoggedMissingTags.Reset();
+	LoggedMissingActions.Reset();
+	bInputLookupDirty = false;
+}
+
+const FUnifyGameplayTagInputLookup& UUnifyGameplayTagInputConfig::GetInputLookup() const
+{
+	// Configs created at runtime or edited in the editor are built on first use
+	if (bInputLookupDirty)
+	{
+		const_cast<UUnifyGameplayTagInputConfig*>(this)->RebuildInputLookup();
+	}
+	return InputLookup;
+}
+
 const UInputAction* UUnifyGameplayTagInputConfig::FindNativeInputActionForTag(const FGameplayTag& InputTag, bool bLogNotFound) const
 {
-	for (const FUnifyGameplayTagInputAction& Action : NativeInputActions)
+	if (const UInputAction* InputAction = GetInputLookup().FindActionForTag(InputTag))
 	{
-		if (Action.InputAction && (Action.InputTag == InputTag))
-		{
-			return Action.InputAction;
-		}
+		return InputAction;
 	}
 
-	if (bLogNotFound)
+	if (bLogNotFound && !LoggedMissingTags.Contains(InputTag))
 	{
+		LoggedMissingTags.Add(InputTag);
 		UE_LOG(LogGameplayTagExtension, Error, TEXT("Can't find NativeInputAction for InputTag [%s] on InputConfig [%s]."), *InputTag.ToString(), *GetNameSafe(this));
 	}
 
 	return nullptr;
-}
\ No newline at end of file
+}
+
+FGameplayTag UUnifyGameplayTagInputConfig::FindInputTagForNativeInputAction(const UInputAction* InputAction, bool bLogNotFound) const
+{
+	const FGameplayTag InputTag = GetInputLookup().FindTagForAction(InputAction);
+	if (InputTag.IsValid())
+	{
+		return InputTag;
+	}
+
+	if (bLogNotFound && !LoggedMissingActions.Contains(InputAction))
+	{
+		LoggedMissingActions.Add(InputAction);
+		UE_LOG(LogGameplayTagExtension, Error, TEXT("Can't find InputTag for NativeInputAction [%s] on InputConfig [%s]."), *GetNameSafe(InputAction), *GetNameSafe(this));
+	}
+
+	return FGameplayTag();
+}
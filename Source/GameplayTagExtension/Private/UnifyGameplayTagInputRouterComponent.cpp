@@ -0,0 +1,118 @@
+// Copyright 2025 Nguyen Phi Hung. All Rights Reserved.
+
+#include "UnifyGameplayTagInputRouterComponent.h"
+#include "UnifyGameplayTagsSubsystem.h"
+#include "GameplayTagExtension.h"
+#include "EnhancedInputComponent.h"
+
+UUnifyGameplayTagInputRouterComponent::UUnifyGameplayTagInputRouterComponent()
+{
+	// Only ticks on frames with pending inputs, after the player controller processed input
+	PrimaryComponentTick.bCanEverTick = true;
+	PrimaryComponentTick.bStartWithTickEnabled = false;
+	PrimaryComponentTick.TickGroup = TG_PostUpdateWork;
+}
+
+void UUnifyGameplayTagInputRouterComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	if (const AActor* Owner = GetOwner())
+	{
+		if (Owner->InputComponent)
+		{
+			BindInputComponent(Owner->InputComponent);
+		}
+	}
+}
+
+void UUnifyGameplayTagInputRouterComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	UnbindInputComponent();
+	PendingInputTags.Empty();
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void UUnifyGameplayTagInputRouterComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	FlushInputTags();
+}
+
+void UUnifyGameplayTagInputRouterComponent::BindInputComponent(UInputComponent* InputComponent)
+{
+	UnbindInputComponent();
+
+	UEnhancedInputComponent* EnhancedInputComponent = Cast<UEnhancedInputComponent>(InputComponent);
+	if (!EnhancedInputComponent)
+	{
+		if (InputComponent)
+		{
+			UE_LOG(LogGameplayTagExtension, Warning, TEXT("Input router [%s] can't bind to [%s], it is not an EnhancedInputComponent."), *GetPathNameSafe(this), *GetNameSafe(InputComponent));
+		}
+		return;
+	}
+
+	FUnifyGameplayTagInputLookup Lookup;
+	for (const UUnifyGameplayTagInputConfig* InputConfig : InputConfigs)
+	{
+		Lookup.AddConfig(InputConfig);
+	}
+
+	BindingHandles.Reserve(Lookup.Num() * RoutedTriggerEvents.Num());
+	for (const TPair<const UInputAction*, FGameplayTag>& Mapping : Lookup.GetActionToTagMap())
+	{
+		for (const ETriggerEvent TriggerEvent : RoutedTriggerEvents)
+		{
+			BindingHandles.Add(EnhancedInputComponent->BindAction(Mapping.Key, TriggerEvent, this, &UUnifyGameplayTagInputRouterComponent::HandleInputTag, Mapping.Value).GetHandle());
+		}
+	}
+
+	// Every action can trigger at most once per trigger event and frame
+	PendingInputTags.Reserve(BindingHandles.Num());
+	BoundInputComponent = EnhancedInputComponent;
+}
+
+void UUnifyGameplayTagInputRouterComponent::UnbindInputComponent()
+{
+	if (UEnhancedInputComponent* EnhancedInputComponent = BoundInputComponent.Get())
+	{
+		for (const uint32 Handle : BindingHandles)
+		{
+			EnhancedInputComponent->RemoveBindingByHandle(Handle);
+		}
+	}
+
+	BindingHandles.Reset();
+	BoundInputComponent.Reset();
+}
+
+void UUnifyGameplayTagInputRouterComponent::HandleInputTag(FGameplayTag InputTag)
+{
+	if (PendingInputTags.IsEmpty())
+	{
+		SetComponentTickEnabled(true);
+	}
+	PendingInputTags.Add(InputTag);
+}
+
+void UUnifyGameplayTagInputRouterComponent::FlushInputTags()
+{
+	SetComponentTickEnabled(false);
+	if (PendingInputTags.IsEmpty())
+	{
+		return;
+	}
+
+	const UWorld* World = GetWorld();
+	if (UUnifyGameplayTagsSubsystem* Subsystem = World ? World->GetSubsystem<UUnifyGameplayTagsSubsystem>() : nullptr)
+	{
+		FGameplayTagMessageData Data;
+		Data.SourceObject = GetOwner();
+		Subsystem->TriggerGameplayTagEvents(GetOwner(), PendingInputTags, Data);
+	}
+
+	PendingInputTags.Reset();
+}
@@ -0,0 +1,107 @@
+// Copyright 2025 Nguyen Phi Hung. All Rights Reserved.
+
+#include "UnifyGameplayTagTimerWheel.h"
+#include "UnifyGameplayTagsComponent.h"
+
+FUnifyGameplayTagTimerWheel::FUnifyGameplayTagTimerWheel(double InTickSeconds)
+	: TickSeconds(FMath::Max(InTickSeconds, UE_DOUBLE_KINDA_SMALL_NUMBER))
+{
+}
+
+void FUnifyGameplayTagTimerWheel::Reset(double Time)
+{
+	for (int32 Level = 0; Level < NumLevels; ++Level)
+	{
+		for (int32 Slot = 0; Slot < NumSlots; ++Slot)
+		{
+			Slots[Level][Slot].Reset();
+		}
+	}
+
+	StartTime = Time;
+	CurrentTick = 0;
+	NumEntries = 0;
+}
+
+void FUnifyGameplayTagTimerWheel::Schedule(double ExpiryTime, FEntry&& Entry)
+{
+	// The current tick has already been processed, so the earliest an entry can expire is the next one
+	Entry.ExpiryTick = FMath::Max(TimeToExpiryTick(ExpiryTime), CurrentTick + 1);
+	Insert(MoveTemp(Entry));
+	++NumEntries;
+}
+
+void FUnifyGameplayTagTimerWheel::Advance(double Time, TArray<FEntry>& OutExpired)
+{
+	// Only ticks that have fully elapsed are processed, so entries never expire before their time
+	const uint64 TargetTick = TimeToElapsedTick(Time);
+	if (NumEntries == 0)
+	{
+		CurrentTick = FMath::Max(CurrentTick, TargetTick);
+		return;
+	}
+
+	while (CurrentTick < TargetTick && NumEntries > 0)
+	{
+		++CurrentTick;
+
+		// When a level wraps, redistribute the matching slot of the level above into the lower levels
+		for (int32 Level = 1; Level < NumLevels; ++Level)
+		{
+			if ((CurrentTick & ((uint64(1) << (SlotBits * Level)) - 1)) != 0)
+			{
+				break;
+			}
+
+			TArray<FEntry>& CascadedSlot = Slots[Level][(CurrentTick >> (SlotBits * Level)) & SlotMask];
+			TArray<FEntry> CascadedEntries = MoveTemp(CascadedSlot);
+			CascadedSlot.Reset();
+			for (FEntry& Entry : CascadedEntries)
+			{
+				Insert(MoveTemp(Entry));
+			}
+		}
+
+		// Every entry of the current base slot is due
+		TArray<FEntry>& DueSlot = Slots[0][CurrentTick & SlotMask];
+		NumEntries -= DueSlot.Num();
+		OutExpired.Append(MoveTemp(DueSlot));
+		DueSlot.Reset();
+	}
+
+	CurrentTick = FMath::Max(CurrentTick, TargetTick);
+}
+
+uint64 FUnifyGameplayTagTimerWheel::TimeToExpiryTick(double Time) const
+{
+	return static_cast<uint64>(FMath::Max(FMath::CeilToDouble((Time - StartTime) / TickSeconds), 0.0));
+}
+
+uint64 FUnifyGameplayTagTimerWheel::TimeToElapsedTick(double Time) const
+{
+	return static_cast<uint64>(FMath::Max(FMath::FloorToDouble((Time - StartTime) / TickSeconds), 0.0));
+}
+
+void FUnifyGameplayTagTimerWheel::Insert(FEntry&& Entry)
+{
+	if (Entry.ExpiryTick <= CurrentTick)
+	{
+		// Only happens while cascading, the current base slot is processed right after
+		Slots[0][CurrentTick & SlotMask].Add(MoveTemp(Entry));
+		return;
+	}
+
+	// Entries further away than the top level can cover are placed on the top level and re-examined when their slot cascades
+	const uint64 Delta = Entry.ExpiryTick - CurrentTick;
+	int32 Level = NumLevels - 1;
+	for (int32 CandidateLevel = 0; CandidateLevel < NumLevels; ++CandidateLevel)
+	{
+		if (Delta < (uint64(1) << (SlotBits * (CandidateLevel + 1))))
+		{
+			Level = CandidateLevel;
+			break;
+		}
+	}
+
+	Slots[Level][(Entry.ExpiryTick >> (SlotBits * Level)) & SlotMask].Add(MoveTemp(Entry));
+}
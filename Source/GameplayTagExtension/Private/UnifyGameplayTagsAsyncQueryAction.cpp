@@ -0,0 +1,61 @@
+// Copyright 2025 Nguyen Phi Hung. All Rights Reserved.
+
+#include "UnifyGameplayTagsAsyncQueryAction.h"
+#include "UnifyGameplayTagsSubsystem.h"
+#include "Engine/Engine.h"
+
+UUnifyGameplayTagsAsyncQueryAction* UUnifyGameplayTagsAsyncQueryAction::GetAllActorsOfClassWithGameplayTagsTimeSliced(const UObject* WorldContextObject, TSubclassOf<AActor> ActorClass, const FGameplayTagContainer TagsToCheck, bool bStreamPartialResults)
+{
+	UUnifyGameplayTagsAsyncQueryAction* Action = NewObject<UUnifyGameplayTagsAsyncQueryAction>();
+	Action->ActorClass = ActorClass;
+	Action->TagsToCheck = TagsToCheck;
+	Action->bStreamPartialResults = bStreamPartialResults;
+
+	if (const UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull))
+	{
+		Action->Subsystem = World->GetSubsystem<UUnifyGameplayTagsSubsystem>();
+		Action->RegisterWithGameInstance(WorldContextObject);
+	}
+	return Action;
+}
+
+void UUnifyGameplayTagsAsyncQueryAction::Activate()
+{
+	UUnifyGameplayTagsSubsystem* GameplayTagsSubsystem = Subsystem.Get();
+	if (!GameplayTagsSubsystem)
+	{
+		OnCompleted.Broadcast(TArray<AActor*>());
+		SetReadyToDestroy();
+		return;
+	}
+
+	FOnTimeSlicedTagQueryResults OnPartialResultsDelegate;
+	if (bStreamPartialResults)
+	{
+		OnPartialResultsDelegate.BindUObject(this, &UUnifyGameplayTagsAsyncQueryAction::HandlePartialResults);
+	}
+
+	QueryId = GameplayTagsSubsystem->StartTimeSlicedTagQuery(TagsToCheck, ActorClass, FOnTimeSlicedTagQueryResults::CreateUObject(this, &UUnifyGameplayTagsAsyncQueryAction::HandleCompleted), MoveTemp(OnPartialResultsDelegate));
+}
+
+void UUnifyGameplayTagsAsyncQueryAction::Cancel()
+{
+	if (UUnifyGameplayTagsSubsystem* GameplayTagsSubsystem = Subsystem.Get())
+	{
+		GameplayTagsSubsystem->CancelTimeSlicedTagQuery(QueryId);
+	}
+	QueryId = 0;
+	SetReadyToDestroy();
+}
+
+void UUnifyGameplayTagsAsyncQueryAction::HandlePartialResults(TConstArrayView<AActor*> Actors)
+{
+	OnPartialResults.Broadcast(TArray<AActor*>(Actors));
+}
+
+void UUnifyGameplayTagsAsyncQueryAction::HandleCompleted(TConstArrayView<AActor*> Actors)
+{
+	QueryId = 0;
+	OnCompleted.Broadcast(TArray<AActor*>(Actors));
+	SetReadyToDestroy();
+}
@@ -7,6 +7,23 @@
 #include "UObject/UnrealType.h"
 #include "Misc/AssertionMacros.h"
 
+using FGameplayTagInlineArray = TArray<FGameplayTag, TInlineAllocator<8>>;
+
+namespace UnifyGameplayTagsComponent
+{
+	/**
+	 * Whether a component class overrides any tag query in Blueprint.
+	 * Not cached across components: a Blueprint recompile keeps the class but can add or remove overrides.
+	 */
+	static bool DoesClassOverrideTagQueries(const UClass* Class)
+	{
+		return Class->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(IUnifyGameplayTagsInterface, GetGameplayTagContainer))
+			|| Class->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(IUnifyGameplayTagsInterface, HasGameplayTag))
+			|| Class->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(IUnifyGameplayTagsInterface, HasAllGameplayTags))
+			|| Class->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(IUnifyGameplayTagsInterface, HasAnyGameplayTags));
+	}
+}
+
 // Sets default values for this component's properties
 UUnifyGameplayTagsComponent::UUnifyGameplayTagsComponent()
 {
@@ -17,11 +34,43 @@ UUnifyGameplayTagsComponent::UUnifyGameplayTagsComponent()
 	// Initialize the event tags as invalid
 	LastBoundMessageTag = FGameplayTag::EmptyTag;
 	CurrentEventTag = FGameplayTag::EmptyTag;
+
+	// Go through the interface until the class has been checked for Blueprint overrides
+	bHasBlueprintTagQueries = true;
+}
+
+void UUnifyGameplayTagsComponent::OnRegister()
+{
+	Super::OnRegister();
+
+	bHasBlueprintTagQueries = UnifyGameplayTagsComponent::DoesClassOverrideTagQueries(GetClass());
+
+	// Move the authored tags to the compact storage, once, so re-registering doesn't bring back removed tags.
+	// Editor worlds keep the authored property as is, it is serialized and edited there.
+	const UWorld* World = GetWorld();
+	if (bUseCompactTagStorage && !CompactStorage && World && World->IsGameWorld())
+	{
+		CompactStorage = MakeUnique<FCompactTagStorage>();
+		for (const FGameplayTag& Tag : GameplayTagContainer.GetGameplayTagArray())
+		{
+			CompactStorage->Tags.AddTag(Tag);
+		}
+		CompactStorage->bMirrorDirty = true;
+
+		// Release the heap container, the tags now only live in the compact storage
+		GameplayTagContainer = FGameplayTagContainer();
+	}
 }
 
 void UUnifyGameplayTagsComponent::BeginPlay()
 {
 	Super::BeginPlay();
+
+	// Tags authored on the component count as a single stack each
+	if (bUseTagCounts)
+	{
+		ResetTagCountsFromContainer();
+	}
 	
 	// Register this component with the UnifyGameplayTagsSubsystem
 	if (UWorld* World = GetWorld())
@@ -29,6 +78,7 @@ void UUnifyGameplayTagsComponent::BeginPlay()
 		if (UUnifyGameplayTagsSubsystem* Subsystem = World->GetSubsystem<UUnifyGameplayTagsSubsystem>())
 		{
 			Subsystem->RegisterComponent(this);
+			RegisteredSubsystem = Subsystem;
 			// Update the event binding with the current tag
 			UpdateEventBinding();
 		}
@@ -37,6 +87,13 @@ void UUnifyGameplayTagsComponent::BeginPlay()
 
 void UUnifyGameplayTagsComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
+	// Deliver the changes of a batch still open while listeners can hear them, the matching EndGameplayTagBatch calls then have nothing left to flush
+	if (TagBatchDepth > 0)
+	{
+		TGuardValue<int32> BatchDepthGuard(TagBatchDepth, 0);
+		FlushGameplayTagBatch();
+	}
+
 	// Unregister this component from the UnifyGameplayTagsSubsystem
 	if (UWorld* World = GetWorld())
 	{
@@ -52,6 +109,8 @@ void UUnifyGameplayTagsComponent::EndPlay(const EEndPlayReason::Type EndPlayReas
 		}
 	}
 
+	RegisteredSubsystem.Reset();
+
 	LastBoundMessageTag = FGameplayTag::EmptyTag;
 	CurrentEventTag = FGameplayTag::EmptyTag;
 	Super::EndPlay(EndPlayReason);
@@ -142,24 +201,68 @@ void UUnifyGameplayTagsComponent::HandleGameplayTagEvent(UObject* Dispatcher, FG
 
 FGameplayTagContainer UUnifyGameplayTagsComponent::GetGameplayTagContainer_Implementation() const
 {
-	return GameplayTagContainer;
+	return CompactStorage ? CompactStorage->Tags.ToContainer() : GameplayTagContainer;
 }
 
 void UUnifyGameplayTagsComponent::SetGameplayTagContainer_Implementation(const FGameplayTagContainer& NewTagContainer)
 {
-	GameplayTagContainer = NewTagContainer;
-	OnGameplayTagContainerChanged.Broadcast(GameplayTagContainer, ETagChangeType::Set);
+	// Only the explicit tags that differ between the two containers are reported
+	FGameplayTagInlineArray AddedTags;
+	FGameplayTagInlineArray RemovedTags;
+	for (const FGameplayTag& Tag : GetExplicitTagsInternal())
+	{
+		if (!NewTagContainer.HasTagExact(Tag))
+		{
+			RemovedTags.Add(Tag);
+		}
+	}
+	for (const FGameplayTag& Tag : NewTagContainer.GetGameplayTagArray())
+	{
+		if (!HasTagExactInternal(Tag))
+		{
+			AddedTags.Add(Tag);
+		}
+	}
+
+	if (AddedTags.IsEmpty() && RemovedTags.IsEmpty())
+	{
+		// The tags are unchanged, but the stacks still start over
+		if (bUseTagCounts)
+		{
+			ResetTagCountsFromContainer();
+		}
+		return;
+	}
+
+	if (CompactStorage)
+	{
+		CompactStorage->Tags.FromContainer(NewTagContainer);
+		CompactStorage->bMirrorDirty = true;
+	}
+	else
+	{
+		GameplayTagContainer = NewTagContainer;
+	}
+	if (bUseTagCounts)
+	{
+		// Setting the container is authoritative, every remaining tag starts over with a single stack
+		ResetTagCountsFromContainer();
+	}
+	for (const FGameplayTag& Tag : RemovedTags)
+	{
+		TimedTagSerials.Remove(Tag);
+	}
+	NotifyGameplayTagsChanged(AddedTags, RemovedTags, ETagChangeType::Set);
 }
 
 void UUnifyGameplayTagsComponent::AddGameplayTag_Implementation(const FGameplayTag& TagToAdd)
 {
-	if (!TagToAdd.IsValid())
+	if (!TagToAdd.IsValid() || !AddTagInternal(TagToAdd))
 	{
 		return;
 	}
 	
-	GameplayTagContainer.AddTag(TagToAdd);
-	OnGameplayTagContainerChanged.Broadcast(FGameplayTagContainer(GameplayTagContainer), ETagChangeType::Add);
+	NotifyGameplayTagsChanged(MakeArrayView(&TagToAdd, 1), TArrayView<const FGameplayTag>(), ETagChangeType::Add);
 }
 
 void UUnifyGameplayTagsComponent::AddGameplayTags_Implementation(const FGameplayTagContainer& TagsToAdd)
@@ -169,19 +272,29 @@ void UUnifyGameplayTagsComponent::AddGameplayTags_Implementation(const FGameplay
 		return;
 	}
 	
-	GameplayTagContainer.AppendTags(TagsToAdd);
-	OnGameplayTagContainerChanged.Broadcast(FGameplayTagContainer(GameplayTagContainer), ETagChangeType::Add);
+	FGameplayTagInlineArray AddedTags;
+	for (const FGameplayTag& Tag : TagsToAdd)
+	{
+		if (Tag.IsValid() && AddTagInternal(Tag))
+		{
+			AddedTags.Add(Tag);
+		}
+	}
+
+	if (!AddedTags.IsEmpty())
+	{
+		NotifyGameplayTagsChanged(AddedTags, TArrayView<const FGameplayTag>(), ETagChangeType::Add);
+	}
 }
 
 void UUnifyGameplayTagsComponent::RemoveGameplayTag_Implementation(const FGameplayTag& TagToRemove)
 {
-	if (!TagToRemove.IsValid() || !GameplayTagContainer.HasTag(TagToRemove))
+	if (!TagToRemove.IsValid() || !RemoveTagInternal(TagToRemove, false))
 	{
 		return;
 	}
 	
-	GameplayTagContainer.RemoveTag(TagToRemove);
-	OnGameplayTagContainerChanged.Broadcast(FGameplayTagContainer(GameplayTagContainer), ETagChangeType::Remove);
+	NotifyGameplayTagsChanged(TArrayView<const FGameplayTag>(), MakeArrayView(&TagToRemove, 1), ETagChangeType::Remove);
 }
 
 void UUnifyGameplayTagsComponent::RemoveGameplayTags_Implementation(const FGameplayTagContainer& TagsToRemove)
@@ -191,43 +304,460 @@ void UUnifyGameplayTagsComponent::RemoveGameplayTags_Implementation(const FGamep
 		return;
 	}
 	
-	bool bAnyRemoved = false;
+	// Defer the parent tag rebuild until every tag has been removed
+	FGameplayTagInlineArray RemovedTags;
 	for (const FGameplayTag& Tag : TagsToRemove)
 	{
-		if (GameplayTagContainer.HasTag(Tag))
+		if (RemoveTagInternal(Tag, true))
 		{
-			GameplayTagContainer.RemoveTag(Tag);
-			bAnyRemoved = true;
+			RemovedTags.Add(Tag);
 		}
 	}
 	
-	if (bAnyRemoved)
+	if (!RemovedTags.IsEmpty())
 	{
-		OnGameplayTagContainerChanged.Broadcast(FGameplayTagContainer(GameplayTagContainer), ETagChangeType::Remove);
+		if (CompactStorage)
+		{
+			CompactStorage->Tags.FillParentTags();
+		}
+		else
+		{
+			GameplayTagContainer.FillParentTags();
+		}
+		NotifyGameplayTagsChanged(TArrayView<const FGameplayTag>(), RemovedTags, ETagChangeType::Remove);
 	}
 }
 
 bool UUnifyGameplayTagsComponent::HasGameplayTag_Implementation(const FGameplayTag& TagToCheck) const
 {
-	return GameplayTagContainer.HasTag(TagToCheck);
+	return HasTagInternal(TagToCheck);
 }
 
 bool UUnifyGameplayTagsComponent::HasAllGameplayTags_Implementation(const FGameplayTagContainer& TagsToCheck) const
 {
-	return GameplayTagContainer.HasAll(TagsToCheck);
+	return HasAllTagsInternal(TagsToCheck);
 }
 
 bool UUnifyGameplayTagsComponent::HasAnyGameplayTags_Implementation(const FGameplayTagContainer& TagsToCheck) const
 {
-	return GameplayTagContainer.HasAny(TagsToCheck);
+	return HasAnyTagsInternal(TagsToCheck);
 }
 
 void UUnifyGameplayTagsComponent::ClearGameplayTags_Implementation()
 {
-	if (!GameplayTagContainer.IsEmpty())
+	if (CompactStorage)
+	{
+		if (CompactStorage->Tags.IsEmpty())
+		{
+			return;
+		}
+
+		// Listeners of the container delegate receive the container as it was before the clear
+		const FGameplayTagInlineArray RemovedTags(CompactStorage->Tags.GetExplicitTags());
+		const FGameplayTagContainer OldContainer = OnGameplayTagContainerChanged.IsBound() ? CompactStorage->Tags.ToContainer() : FGameplayTagContainer();
+		CompactStorage->Tags.Reset();
+		CompactStorage->bMirrorDirty = true;
+		TagCounts.Reset();
+		TimedTagSerials.Reset();
+		TimedTagStacks.Reset();
+		NotifyGameplayTagsChanged(TArrayView<const FGameplayTag>(), RemovedTags, ETagChangeType::Clear, &OldContainer);
+	}
+	else if (!GameplayTagContainer.IsEmpty())
 	{
-		FGameplayTagContainer OldContainer = FGameplayTagContainer(GameplayTagContainer);
+		// Listeners of the container delegate receive the container as it was before the clear
+		const FGameplayTagContainer OldContainer = MoveTemp(GameplayTagContainer);
 		GameplayTagContainer.Reset();
-		OnGameplayTagContainerChanged.Broadcast(OldContainer, ETagChangeType::Clear);
+		TagCounts.Reset();
+		TimedTagSerials.Reset();
+		TimedTagStacks.Reset();
+		NotifyGameplayTagsChanged(TArrayView<const FGameplayTag>(), OldContainer.GetGameplayTagArray(), ETagChangeType::Clear, &OldContainer);
+	}
+}
+
+const FGameplayTagContainer& UUnifyGameplayTagsComponent::GetCompactTagMirror() const
+{
+	if (CompactStorage->bMirrorDirty)
+	{
+		CompactStorage->Mirror = CompactStorage->Tags.ToContainer();
+		CompactStorage->bMirrorDirty = false;
+	}
+	return CompactStorage->Mirror;
+}
+
+void UUnifyGameplayTagsComponent::AddGameplayTagWithDuration(const FGameplayTag& TagToAdd, float Duration)
+{
+	if (!TagToAdd.IsValid())
+	{
+		return;
+	}
+
+	Execute_AddGameplayTag(this, TagToAdd);
+
+	UUnifyGameplayTagsSubsystem* Subsystem = RegisteredSubsystem.Get();
+	if (Duration <= 0.f || !Subsystem)
+	{
+		UE_CLOG(!Subsystem && Duration > 0.f, LogGameplayTagExtension, Warning, TEXT("AddGameplayTagWithDuration: %s is not registered with a UnifyGameplayTagsSubsystem, tag [%s] will not expire."), *GetNameSafe(this), *TagToAdd.ToString());
+		return;
+	}
+
+	if (++NextTimedTagSerial == 0)
+	{
+		++NextTimedTagSerial;
+	}
+	const uint32 Serial = NextTimedTagSerial;
+	if (bUseTagCounts)
+	{
+		// The stack just pushed is the top one, it expires on its own
+		const int32* Count = TagCounts.Find(TagToAdd);
+		if (!Count)
+		{
+			return;
+		}
+		TimedTagStacks.FindOrAdd(TagToAdd).Add(FTimedTagStack{ Serial, *Count - 1 });
+	}
+	else
+	{
+		// Adding the tag cleared any pending expiry, the new serial makes this one the only valid timer
+		TimedTagSerials.Add(TagToAdd, Serial);
+	}
+
+	Subsystem->ScheduleTagExpiry(this, TagToAdd, Duration, Serial);
+}
+
+void UUnifyGameplayTagsComponent::HandleTimedTagExpired(const FGameplayTag& Tag, uint32 Serial)
+{
+	if (bUseTagCounts)
+	{
+		// Stacks removed explicitly, or dropped by a reset of the counts, no longer exist
+		TArray<FTimedTagStack>* TimedStacks = TimedTagStacks.Find(Tag);
+		const int32 TimedStackIndex = TimedStacks ? TimedStacks->IndexOfByPredicate([Serial](const FTimedTagStack& Stack) { return Stack.Serial == Serial; }) : INDEX_NONE;
+		if (TimedStackIndex == INDEX_NONE)
+		{
+			return;
+		}
+
+		// The expired stack leaves, the ones pushed after it move down so the removal below pops it and not the top one
+		TimedStacks->RemoveAt(TimedStackIndex);
+		for (int32 Index = TimedStackIndex; Index < TimedStacks->Num(); ++Index)
+		{
+			--(*TimedStacks)[Index].StackIndex;
+		}
+		if (TimedStacks->IsEmpty())
+		{
+			TimedTagStacks.Remove(Tag);
+		}
+	}
+	else
+	{
+		const uint32* PendingSerial = TimedTagSerials.Find(Tag);
+		if (!PendingSerial || *PendingSerial != Serial)
+		{
+			return;
+		}
+		TimedTagSerials.Remove(Tag);
+	}
+
+	Execute_RemoveGameplayTag(this, Tag);
+}
+
+int32 UUnifyGameplayTagsComponent::GetGameplayTagCount(const FGameplayTag& Tag) const
+{
+	if (bUseTagCounts)
+	{
+		const int32* Count = TagCounts.Find(Tag);
+		return Count ? *Count : 0;
+	}
+	return HasTagExactInternal(Tag) ? 1 : 0;
+}
+
+bool UUnifyGameplayTagsComponent::AddTagInternal(const FGameplayTag& Tag)
+{
+	if (bUseTagCounts)
+	{
+		// Only the 0 -> 1 transition changes the explicit container
+		int32& Count = TagCounts.FindOrAdd(Tag, 0);
+		if (Count++ > 0)
+		{
+			return false;
+		}
+	}
+	else
+	{
+		// A permanent add cancels the pending expiry of the tag
+		TimedTagSerials.Remove(Tag);
+		if (HasTagExactInternal(Tag))
+		{
+			return false;
+		}
+	}
+
+	if (CompactStorage)
+	{
+		CompactStorage->Tags.AddTag(Tag);
+		CompactStorage->bMirrorDirty = true;
+	}
+	else
+	{
+		GameplayTagContainer.AddTag(Tag);
+	}
+	return true;
+}
+
+bool UUnifyGameplayTagsComponent::RemoveTagInternal(const FGameplayTag& Tag, bool bDeferParentTags)
+{
+	if (bUseTagCounts)
+	{
+		// Only the 1 -> 0 transition changes the explicit container
+		if (int32* Count = TagCounts.Find(Tag))
+		{
+			// Removing the top stack consumes it, a timed one must not pop another stack when its expiry fires
+			--(*Count);
+			if (TArray<FTimedTagStack>* TimedStacks = TimedTagStacks.Find(Tag))
+			{
+				if (TimedStacks->Last().StackIndex >= *Count)
+				{
+					TimedStacks->Pop(EAllowShrinking::No);
+				}
+				if (TimedStacks->IsEmpty())
+				{
+					TimedTagStacks.Remove(Tag);
+				}
+			}
+
+			if (*Count > 0)
+			{
+				return false;
+			}
+			TagCounts.Remove(Tag);
+		}
+	}
+
+	const bool bRemoved = CompactStorage ? CompactStorage->Tags.RemoveTag(Tag, bDeferParentTags) : GameplayTagContainer.RemoveTag(Tag, bDeferParentTags);
+	if (!bRemoved)
+	{
+		return false;
+	}
+	if (CompactStorage)
+	{
+		CompactStorage->bMirrorDirty = true;
+	}
+
+	TimedTagSerials.Remove(Tag);
+	return true;
+}
+
+void UUnifyGameplayTagsComponent::ResetTagCountsFromContainer()
+{
+	TimedTagStacks.Reset();
+	TagCounts.Reset();
+	const TArrayView<const FGameplayTag> ExplicitTags = GetExplicitTagsInternal();
+	TagCounts.Reserve(ExplicitTags.Num());
+	for (const FGameplayTag& Tag : ExplicitTags)
+	{
+		TagCounts.Add(Tag, 1);
+	}
+}
+
+UUnifyGameplayTagsComponent::FOnGameplayTagChangedNative& UUnifyGameplayTagsComponent::RegisterTagChangedEvent(const FGameplayTag& Tag, bool bIncludeChildren)
+{
+	return bIncludeChildren ? ChildTagChangedEvents.FindOrAdd(Tag) : ExactTagChangedEvents.FindOrAdd(Tag);
+}
+
+void UUnifyGameplayTagsComponent::UnregisterTagChangedEvent(const FGameplayTag& Tag, bool bIncludeChildren, FDelegateHandle Handle)
+{
+	TMap<FGameplayTag, FOnGameplayTagChangedNative>& Events = bIncludeChildren ? ChildTagChangedEvents : ExactTagChangedEvents;
+	if (FOnGameplayTagChangedNative* Event = Events.Find(Tag))
+	{
+		Event->Remove(Handle);
+		if (!Event->IsBound())
+		{
+			Events.Remove(Tag);
+		}
+	}
+}
+
+void UUnifyGameplayTagsComponent::BroadcastTagChangedEvents(TArrayView<const FGameplayTag> AddedTags, TArrayView<const FGameplayTag> RemovedTags)
+{
+	// Events are copied before broadcasting since listeners may register new events and reallocate the maps
+	auto BroadcastExactEvents = [this](TArrayView<const FGameplayTag> ChangedTags)
+	{
+		for (const FGameplayTag& Tag : ChangedTags)
+		{
+			if (const FOnGameplayTagChangedNative* Event = ExactTagChangedEvents.Find(Tag))
+			{
+				const FOnGameplayTagChangedNative EventCopy = *Event;
+				EventCopy.Broadcast(Tag, HasTagExactInternal(Tag));
+			}
+		}
+	};
+	BroadcastExactEvents(AddedTags);
+	BroadcastExactEvents(RemovedTags);
+
+	if (ChildTagChangedEvents.IsEmpty())
+	{
+		return;
+	}
+
+	// Walk up the hierarchy of each changed tag, notifying each registered parent once per change
+	FGameplayTagInlineArray NotifiedTags;
+	auto BroadcastChildEvents = [this, &NotifiedTags](TArrayView<const FGameplayTag> ChangedTags)
+	{
+		for (const FGameplayTag& Tag : ChangedTags)
+		{
+			for (FGameplayTag CurrentTag = Tag; CurrentTag.IsValid(); CurrentTag = CurrentTag.RequestDirectParent())
+			{
+				const FOnGameplayTagChangedNative* Event = ChildTagChangedEvents.Find(CurrentTag);
+				if (Event && !NotifiedTags.Contains(CurrentTag))
+				{
+					NotifiedTags.Add(CurrentTag);
+					const FOnGameplayTagChangedNative EventCopy = *Event;
+					EventCopy.Broadcast(CurrentTag, HasTagInternal(CurrentTag));
+				}
+			}
+		}
+	};
+	BroadcastChildEvents(AddedTags);
+	BroadcastChildEvents(RemovedTags);
+}
+
+void UUnifyGameplayTagsComponent::BeginGameplayTagBatch()
+{
+	++TagBatchDepth;
+}
+
+void UUnifyGameplayTagsComponent::EndGameplayTagBatch()
+{
+	if (!ensureMsgf(TagBatchDepth > 0, TEXT("EndGameplayTagBatch called on %s without a matching BeginGameplayTagBatch."), *GetNameSafe(this)))
+	{
+		return;
+	}
+
+	if (--TagBatchDepth > 0)
+	{
+		return;
+	}
+
+	FlushGameplayTagBatch();
+}
+
+void UUnifyGameplayTagsComponent::FlushGameplayTagBatch()
+{
+	if (PendingAddedTags.IsEmpty() && PendingRemovedTags.IsEmpty())
+	{
+		PendingChangeType.Reset();
+		PendingBroadcastContainer.Reset();
+		return;
+	}
+
+	// Move the pending delta out first so listeners can safely open a new batch
+	const TArray<FGameplayTag> AddedTags = MoveTemp(PendingAddedTags);
+	const TArray<FGameplayTag> RemovedTags = MoveTemp(PendingRemovedTags);
+	const ETagChangeType ChangeType = PendingChangeType.Get(ETagChangeType::Set);
+
+	// A batch of clears reports the container from before the batch, like a single clear
+	TOptional<FGameplayTagContainer> BroadcastContainer;
+	if (ChangeType == ETagChangeType::Clear)
+	{
+		BroadcastContainer = MoveTemp(PendingBroadcastContainer);
+	}
+
+	PendingAddedTags.Reset();
+	PendingRemovedTags.Reset();
+	PendingChangeType.Reset();
+	PendingBroadcastContainer.Reset();
+
+	NotifyGameplayTagsChanged(AddedTags, RemovedTags, ChangeType, BroadcastContainer.GetPtrOrNull());
+}
+
+void UUnifyGameplayTagsComponent::NotifyGameplayTagsChanged(TArrayView<const FGameplayTag> AddedTags, TArrayView<const FGameplayTag> RemovedTags, ETagChangeType ChangeType, const FGameplayTagContainer* BroadcastContainer)
+{
+	UUnifyGameplayTagsSubsystem* Subsystem = RegisteredSubsystem.Get();
+	if (TagBatchDepth > 0)
+	{
+		// The subsystem is notified when the batch ends, only its tag generation moves now so cached queries see the change
+		if (Subsystem)
+		{
+			Subsystem->MarkComponentTagsDirty();
+		}
+
+		// Coalesce into the pending delta, a tag added then removed within the batch (or the reverse) cancels out
+		for (const FGameplayTag& Tag : AddedTags)
+		{
+			if (PendingRemovedTags.RemoveSwap(Tag) == 0)
+			{
+				PendingAddedTags.AddUnique(Tag);
+			}
+		}
+		for (const FGameplayTag& Tag : RemovedTags)
+		{
+			if (PendingAddedTags.RemoveSwap(Tag) == 0)
+			{
+				PendingRemovedTags.AddUnique(Tag);
+			}
+		}
+
+		if (BroadcastContainer && !PendingBroadcastContainer.IsSet())
+		{
+			PendingBroadcastContainer = *BroadcastContainer;
+		}
+
+		if (!PendingChangeType.IsSet())
+		{
+			PendingChangeType = ChangeType;
+		}
+		else if (PendingChangeType.GetValue() != ChangeType)
+		{
+			PendingChangeType = ETagChangeType::Set;
+		}
+		return;
+	}
+
+	if (Subsystem)
+	{
+		Subsystem->NotifyComponentTagsChanged(this, AddedTags, RemovedTags);
+	}
+
+	if (!ExactTagChangedEvents.IsEmpty() || !ChildTagChangedEvents.IsEmpty())
+	{
+		BroadcastTagChangedEvents(AddedTags, RemovedTags);
+	}
+
+	OnGameplayTagsDeltaNative.Broadcast(this, AddedTags, RemovedTags);
+
+	if (OnGameplayTagsDelta.IsBound())
+	{
+		FGameplayTagContainer AddedContainer;
+		FGameplayTagContainer RemovedContainer;
+		for (const FGameplayTag& Tag : AddedTags)
+		{
+			AddedContainer.AddTagFast(Tag);
+		}
+		for (const FGameplayTag& Tag : RemovedTags)
+		{
+			RemovedContainer.AddTagFast(Tag);
+		}
+		OnGameplayTagsDelta.Broadcast(AddedContainer, RemovedContainer);
+	}
+
+	if (OnGameplayTagContainerChanged.IsBound())
+	{
+		OnGameplayTagContainerChanged.Broadcast(BroadcastContainer ? *BroadcastContainer : GetOwnedGameplayTags(), ChangeType);
+	}
+}
+
+FUnifyGameplayTagsBatchScope::FUnifyGameplayTagsBatchScope(UUnifyGameplayTagsComponent* InComponent)
+	: Component(InComponent)
+{
+	if (InComponent)
+	{
+		InComponent->BeginGameplayTagBatch();
+	}
+}
+
+FUnifyGameplayTagsBatchScope::~FUnifyGameplayTagsBatchScope()
+{
+	if (UUnifyGameplayTagsComponent* ComponentPtr = Component.Get())
+	{
+		ComponentPtr->EndGameplayTagBatch();
 	}
 }
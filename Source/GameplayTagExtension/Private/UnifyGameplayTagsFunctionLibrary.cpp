@@ -7,25 +7,57 @@
 #include "UnifyGameplayTagsSubsystem.h"
 #include "Engine/Engine.h"
 #include "Subsystems/SubsystemBlueprintLibrary.h"
+#include "Async/ParallelFor.h"
 
 UUnifyGameplayTagsComponent* UUnifyGameplayTagsFunctionLibrary::GetGameplayTagComponent(const AActor* Actor)
 {
-    return Cast<UUnifyGameplayTagsComponent>(Actor->GetComponentByClass(UUnifyGameplayTagsComponent::StaticClass()));
+    return FindGameplayTagComponent(Actor, GetActorGameplayTagsSubsystem(Actor));
+}
+
+UUnifyGameplayTagsComponent* UUnifyGameplayTagsFunctionLibrary::FindGameplayTagComponent(const AActor* Actor, const UUnifyGameplayTagsSubsystem* Subsystem)
+{
+    if (!Actor)
+    {
+        return nullptr;
+    }
+
+    if (Subsystem)
+    {
+        if (UUnifyGameplayTagsComponent* Component = Subsystem->FindComponentForActor(Actor))
+        {
+            return Component;
+        }
+    }
+
+    // Components are only registered once they begun play
+    return Actor->FindComponentByClass<UUnifyGameplayTagsComponent>();
+}
+
+UUnifyGameplayTagsSubsystem* UUnifyGameplayTagsFunctionLibrary::GetActorGameplayTagsSubsystem(const AActor* Actor)
+{
+    const UWorld* World = Actor ? Actor->GetWorld() : nullptr;
+    return World ? World->GetSubsystem<UUnifyGameplayTagsSubsystem>() : nullptr;
 }
 
 FGameplayTagContainer UUnifyGameplayTagsFunctionLibrary::GetGameplayTagContainer(const AActor* Actor, bool& bSuccess)
 {
-    bSuccess = GetGameplayTagComponent(Actor) != nullptr;
-    return bSuccess ? GetGameplayTagComponent(Actor)->GetGameplayTagContainer() : FGameplayTagContainer();
+    const UUnifyGameplayTagsComponent* Component = GetGameplayTagComponent(Actor);
+    bSuccess = Component != nullptr;
+    return bSuccess ? Component->GetGameplayTagContainerNative() : FGameplayTagContainer();
 }
 
 TArray<AActor*> UUnifyGameplayTagsFunctionLibrary::FilterActorsWithGameplayTags(const TArray<AActor*>& ActorsToCheck, const FGameplayTagContainer TagsToCheck)
 {
     TArray<AActor*> FilteredActors;
+    const UUnifyGameplayTagsSubsystem* Subsystem = nullptr;
     for (AActor* Actor : ActorsToCheck)
     {
-        UUnifyGameplayTagsComponent* Component = GetGameplayTagComponent(Actor);
-        if (Component && Component->HasAnyGameplayTags(TagsToCheck))
+        if (!Subsystem)
+        {
+            Subsystem = GetActorGameplayTagsSubsystem(Actor);
+        }
+        UUnifyGameplayTagsComponent* Component = FindGameplayTagComponent(Actor, Subsystem);
+        if (Component && Component->HasAnyGameplayTagsNative(TagsToCheck))
         {
             FilteredActors.Add(Actor);
         }
@@ -98,11 +130,11 @@ bool UUnifyGameplayTagsFunctionLibrary::IsActorHasGameplayTags(const UObject* Wo
     {
         if (CheckType == EGameplayTagCheckType::Any)
         {
-            return Component->HasAnyGameplayTags(TagsToCheck);
+            return Component->HasAnyGameplayTagsNative(TagsToCheck);
         }
         else if (CheckType == EGameplayTagCheckType::Exact)
         {
-            return Component->HasAllGameplayTags(TagsToCheck);
+            return Component->HasAllGameplayTagsNative(TagsToCheck);
         }
     }
     return false;
@@ -135,5 +167,136 @@ void UUnifyGameplayTagsFunctionLibrary::RunGameplayTagOperationOnActor(const UOb
             break;
     }
     bSuccess = true; 
-    OutContainer = Component->GetGameplayTagContainer();
+    OutContainer = Component->GetGameplayTagContainerNative();
+}
+
+void UUnifyGameplayTagsFunctionLibrary::ResolveGameplayTagComponents(const UObject* WorldContextObject, const TArray<AActor*>& Actors, TArray<UUnifyGameplayTagsComponent*>& OutComponents, bool& bOutHasBlueprintQueries)
+{
+    const UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull);
+    const UUnifyGameplayTagsSubsystem* Subsystem = World ? World->GetSubsystem<UUnifyGameplayTagsSubsystem>() : nullptr;
+
+    bOutHasBlueprintQueries = false;
+    OutComponents.SetNumUninitialized(Actors.Num());
+    for (int32 Index = 0; Index < Actors.Num(); ++Index)
+    {
+        UUnifyGameplayTagsComponent* Component = FindGameplayTagComponent(Actors[Index], Subsystem);
+        OutComponents[Index] = Component;
+        bOutHasBlueprintQueries |= Component && Component->HasBlueprintTagQueries();
+    }
+}
+
+int32 UUnifyGameplayTagsFunctionLibrary::RunGameplayTagOperationOnActors(const UObject* WorldContextObject, const TArray<AActor*>& Actors, const FGameplayTagContainer Tags, ETagChangeType OperationType, TArray<bool>& OutSuccess)
+{
+    QUICK_SCOPE_CYCLE_COUNTER(UnifyGameplayTags_RunGameplayTagOperationOnActors);
+
+    TArray<UUnifyGameplayTagsComponent*> Components;
+    bool bHasBlueprintQueries = false;
+    ResolveGameplayTagComponents(WorldContextObject, Actors, Components, bHasBlueprintQueries);
+
+    // Defer every notification until all components were modified
+    for (UUnifyGameplayTagsComponent* Component : Components)
+    {
+        if (Component)
+        {
+            Component->BeginGameplayTagBatch();
+        }
+    }
+
+    int32 NumSucceeded = 0;
+    OutSuccess.SetNumUninitialized(Components.Num());
+    for (int32 Index = 0; Index < Components.Num(); ++Index)
+    {
+        UUnifyGameplayTagsComponent* Component = Components[Index];
+        OutSuccess[Index] = Component != nullptr;
+        if (!Component)
+        {
+            continue;
+        }
+
+        switch (OperationType)
+        {
+            case ETagChangeType::Set:
+                IUnifyGameplayTagsInterface::Execute_SetGameplayTagContainer(Component, Tags);
+                break;
+            case ETagChangeType::Add:
+                IUnifyGameplayTagsInterface::Execute_AddGameplayTags(Component, Tags);
+                break;
+            case ETagChangeType::Remove:
+                IUnifyGameplayTagsInterface::Execute_RemoveGameplayTags(Component, Tags);
+                break;
+            case ETagChangeType::Clear:
+                IUnifyGameplayTagsInterface::Execute_ClearGameplayTags(Component);
+                break;
+            default:
+                break;
+        }
+        ++NumSucceeded;
+    }
+
+    for (UUnifyGameplayTagsComponent* Component : Components)
+    {
+        if (Component)
+        {
+            Component->EndGameplayTagBatch();
+        }
+    }
+
+    return NumSucceeded;
+}
+
+int32 UUnifyGameplayTagsFunctionLibrary::AreActorsHasGameplayTags(const UObject* WorldContextObject, const TArray<AActor*>& Actors, const FGameplayTagContainer TagsToCheck, EGameplayTagCheckType CheckType, TArray<bool>& OutResults)
+{
+    QUICK_SCOPE_CYCLE_COUNTER(UnifyGameplayTags_AreActorsHasGameplayTags);
+
+    TArray<UUnifyGameplayTagsComponent*> Components;
+    bool bHasBlueprintQueries = false;
+    ResolveGameplayTagComponents(WorldContextObject, Actors, Components, bHasBlueprintQueries);
+
+    OutResults.SetNumUninitialized(Components.Num());
+    auto CheckComponent = [&Components, &OutResults, &TagsToCheck, CheckType](int32 Index)
+    {
+        const UUnifyGameplayTagsComponent* Component = Components[Index];
+        bool bResult = false;
+        if (Component)
+        {
+            bResult = CheckType == EGameplayTagCheckType::Exact ? Component->HasAllGameplayTagsNative(TagsToCheck) : Component->HasAnyGameplayTagsNative(TagsToCheck);
+        }
+        OutResults[Index] = bResult;
+    };
+
+    // Native queries only read the tag storage and are safe to run off the game thread, Blueprint overrides are not
+    if (!bHasBlueprintQueries && Components.Num() >= ParallelTagCheckThreshold)
+    {
+        ParallelFor(Components.Num(), CheckComponent);
+    }
+    else
+    {
+        for (int32 Index = 0; Index < Components.Num(); ++Index)
+        {
+            CheckComponent(Index);
+        }
+    }
+
+    int32 NumPassed = 0;
+    for (const bool bResult : OutResults)
+    {
+        NumPassed += bResult ? 1 : 0;
+    }
+    return NumPassed;
+}
+
+int32 UUnifyGameplayTagsFunctionLibrary::GetActorsHasGameplayTagsMask(const UObject* WorldContextObject, const TArray<AActor*>& Actors, const FGameplayTagContainer TagsToCheck, EGameplayTagCheckType CheckType, TArray<int32>& OutMask)
+{
+    TArray<bool> Results;
+    const int32 NumPassed = AreActorsHasGameplayTags(WorldContextObject, Actors, TagsToCheck, CheckType, Results);
+
+    OutMask.SetNumZeroed(FMath::DivideAndRoundUp(Results.Num(), 32));
+    for (int32 Index = 0; Index < Results.Num(); ++Index)
+    {
+        if (Results[Index])
+        {
+            OutMask[Index / 32] |= static_cast<int32>(1u << (Index % 32));
+        }
+    }
+    return NumPassed;
 }
@@ -2,6 +2,9 @@
 
 #include "UnifyGameplayTagsSubsystem.h"
 #include "UnifyGameplayTagsComponent.h"
+#include "GameplayTagExtension.h"
+#include "Algo/StableSort.h"
+#include "Misc/CoreDelegates.h"
 
 UUnifyGameplayTagsSubsystem::UUnifyGameplayTagsSubsystem()
 {
@@ -14,20 +17,91 @@ void UUnifyGameplayTagsSubsystem::Initialize(FSubsystemCollectionBase& Collectio
 
 void UUnifyGameplayTagsSubsystem::Deinitialize()
 {
+	FCoreDelegates::OnEndFrame.Remove(EndFrameHandle);
+	EndFrameHandle.Reset();
+	TagQueryCache.Empty();
+
 	// Clear the registered components array
 	RegisteredComponents.Empty();
+	NumBlueprintQueryComponents = 0;
+	ActorComponentMap.Empty();
 	
 	// Clear all event bindings
 	GameplayTagEventsMap.Empty();
+
+	// Complete running queries with what they matched so far, so their callers (e.g. async actions) can clean up
+	TArray<FTimeSlicedTagQuery> RunningQueries = MoveTemp(TimeSlicedQueries);
+	TimeSlicedQueries.Empty();
+	for (FTimeSlicedTagQuery& Query : RunningQueries)
+	{
+		TArray<AActor*> Actors;
+		Actors.Reserve(Query.Results.Num());
+		for (const TWeakObjectPtr<AActor>& Result : Query.Results)
+		{
+			if (AActor* Actor = Result.Get())
+			{
+				Actors.Add(Actor);
+			}
+		}
+		Query.OnCompleted.ExecuteIfBound(Actors);
+	}
+
+	// Drop every pending tag expiry
+	TagExpiryWheel.Reset(0.0);
+	bTagExpiryWheelStarted = false;
+
+	// Drop any recording or replay in progress
+	EventRecordWriter.Reset();
+	EventRecordBuffer.Empty();
+	EventReplayReader.Reset();
+	EventReplayBuffer.Empty();
+	bHasPendingReplayRecord = false;
+	bCollectListenerTimings = false;
 	
 	Super::Deinitialize();
 }
 
+void UUnifyGameplayTagsSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (TagExpiryWheel.Num() > 0)
+	{
+		ProcessTagExpirations();
+	}
+
+	if (TimeSlicedQueries.Num() > 0)
+	{
+		ProcessTimeSlicedQueries();
+	}
+
+	if (EventReplayReader.IsValid())
+	{
+		PumpEventReplay();
+	}
+}
+
+TStatId UUnifyGameplayTagsSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UUnifyGameplayTagsSubsystem, STATGROUP_Tickables);
+}
+
 void UUnifyGameplayTagsSubsystem::RegisterComponent(UUnifyGameplayTagsComponent* Component)
 {
 	if (Component && !RegisteredComponents.Contains(Component))
 	{
 		RegisteredComponents.Add(Component);
+		++TagGeneration;
+		if (Component->HasBlueprintTagQueries())
+		{
+			++NumBlueprintQueryComponents;
+		}
+
+		// The first registered component of an actor is the one returned by lookups, matching GetComponentByClass
+		if (const AActor* Owner = Component->GetOwner())
+		{
+			ActorComponentMap.FindOrAdd(Owner, Component);
+		}
 	}
 }
 
@@ -35,8 +109,47 @@ void UUnifyGameplayTagsSubsystem::UnregisterComponent(UUnifyGameplayTagsComponen
 {
 	if (Component)
 	{
-		// Remove from registered components
-		RegisteredComponents.Remove(Component);
+		// Remove from registered components, keeping the order so running queries only need their cursor moved back
+		const int32 ComponentIndex = RegisteredComponents.IndexOfByKey(Component);
+		if (ComponentIndex != INDEX_NONE)
+		{
+			RegisteredComponents.RemoveAt(ComponentIndex);
+			++TagGeneration;
+			if (Component->HasBlueprintTagQueries())
+			{
+				--NumBlueprintQueryComponents;
+			}
+
+			for (FTimeSlicedTagQuery& Query : TimeSlicedQueries)
+			{
+				if (ComponentIndex < Query.Cursor)
+				{
+					--Query.Cursor;
+				}
+			}
+		}
+
+		// Point the actor at its next registered component, if it has more than one
+		const AActor* Owner = Component->GetOwner();
+		if (UUnifyGameplayTagsComponent** MappedComponent = ActorComponentMap.Find(Owner))
+		{
+			if (*MappedComponent == Component)
+			{
+				UUnifyGameplayTagsComponent* const* OtherComponent = RegisteredComponents.FindByPredicate([Owner](const UUnifyGameplayTagsComponent* Candidate)
+				{
+					return Candidate && Candidate->GetOwner() == Owner;
+				});
+
+				if (OtherComponent)
+				{
+					*MappedComponent = *OtherComponent;
+				}
+				else
+				{
+					ActorComponentMap.Remove(Owner);
+				}
+			}
+		}
 		
 		// Remove all event bindings for this component
 		for (auto& EventPair : GameplayTagEventsMap)
@@ -50,43 +163,309 @@ void UUnifyGameplayTagsSubsystem::UnregisterComponent(UUnifyGameplayTagsComponen
 	}
 }
 
-TArray<UUnifyGameplayTagsComponent*> UUnifyGameplayTagsSubsystem::GetComponentsWithTag(const FGameplayTag& Tag) const
+UUnifyGameplayTagsSubsystem::FTagQueryCacheKey::FTagQueryCacheKey(ETagQueryCacheType InQueryType, const FGameplayTagContainer& InTags)
+	: Tags(InTags)
+	, QueryType(InQueryType)
+	, Hash(GetTypeHash(static_cast<uint8>(InQueryType)))
 {
+	uint32 TagsHash = 0;
+	for (const FGameplayTag& Tag : Tags)
+	{
+		TagsHash += MurmurFinalize32(GetTypeHash(Tag));
+	}
+	Hash = HashCombineFast(Hash, TagsHash);
+}
+
+template<typename PredicateType>
+TArray<UUnifyGameplayTagsComponent*> UUnifyGameplayTagsSubsystem::RunCachedTagQuery(ETagQueryCacheType QueryType, const FGameplayTagContainer& Tags, PredicateType&& Predicate) const
+{
+	TOptional<FTagQueryCacheKey> CacheKey;
+	if (bTagQueryCacheEnabled && NumBlueprintQueryComponents == 0)
+	{
+		// Any tag or registry change since the results were cached makes all of them stale
+		if (TagQueryCacheGeneration != TagGeneration)
+		{
+			TagQueryCache.Reset();
+			TagQueryCacheGeneration = TagGeneration;
+		}
+
+		CacheKey.Emplace(QueryType, Tags);
+		if (const TArray<UUnifyGameplayTagsComponent*>* CachedResult = TagQueryCache.Find(CacheKey.GetValue()))
+		{
+			return *CachedResult;
+		}
+	}
+
 	TArray<UUnifyGameplayTagsComponent*> Result;
 	for (UUnifyGameplayTagsComponent* Component : RegisteredComponents)
 	{
-		if (Component && Component->HasGameplayTag(Tag))
+		if (Component && Predicate(Component))
 		{
 			Result.Add(Component);
 		}
 	}
+
+	if (CacheKey.IsSet())
+	{
+		TagQueryCache.Add(MoveTemp(CacheKey.GetValue()), Result);
+	}
 	return Result;
 }
 
+TArray<UUnifyGameplayTagsComponent*> UUnifyGameplayTagsSubsystem::GetComponentsWithTag(const FGameplayTag& Tag) const
+{
+	// The container is only needed as a cache key, skip building it when the cache is off
+	return RunCachedTagQuery(ETagQueryCacheType::Tag, bTagQueryCacheEnabled ? FGameplayTagContainer(Tag) : FGameplayTagContainer(), [&Tag](const UUnifyGameplayTagsComponent* Component)
+	{
+		return Component->HasGameplayTagNative(Tag);
+	});
+}
+
 TArray<UUnifyGameplayTagsComponent*> UUnifyGameplayTagsSubsystem::GetComponentsWithAnyTags(const FGameplayTagContainer& Tags) const
 {
-	TArray<UUnifyGameplayTagsComponent*> Result;
-	for (UUnifyGameplayTagsComponent* Component : RegisteredComponents)
+	return RunCachedTagQuery(ETagQueryCacheType::Any, Tags, [&Tags](const UUnifyGameplayTagsComponent* Component)
 	{
-		if (Component && Component->HasAnyGameplayTags(Tags))
+		return Component->HasAnyGameplayTagsNative(Tags);
+	});
+}
+
+TArray<UUnifyGameplayTagsComponent*> UUnifyGameplayTagsSubsystem::GetComponentsWithAllTags(const FGameplayTagContainer& Tags) const
+{
+	return RunCachedTagQuery(ETagQueryCacheType::All, Tags, [&Tags](const UUnifyGameplayTagsComponent* Component)
+	{
+		return Component->HasAllGameplayTagsNative(Tags);
+	});
+}
+
+void UUnifyGameplayTagsSubsystem::SetTagQueryCacheEnabled(bool bEnabled)
+{
+	if (bTagQueryCacheEnabled == bEnabled)
+	{
+		return;
+	}
+
+	bTagQueryCacheEnabled = bEnabled;
+	TagQueryCache.Empty();
+	if (bEnabled)
+	{
+		EndFrameHandle = FCoreDelegates::OnEndFrame.AddUObject(this, &UUnifyGameplayTagsSubsystem::HandleEndFrame);
+	}
+	else
+	{
+		FCoreDelegates::OnEndFrame.Remove(EndFrameHandle);
+		EndFrameHandle.Reset();
+	}
+}
+
+void UUnifyGameplayTagsSubsystem::HandleEndFrame()
+{
+	TagQueryCache.Reset();
+}
+
+void UUnifyGameplayTagsSubsystem::NotifyComponentTagsChanged(UUnifyGameplayTagsComponent* Component, TArrayView<const FGameplayTag> AddedTags, TArrayView<const FGameplayTag> RemovedTags)
+{
+	if (Component && (AddedTags.Num() > 0 || RemovedTags.Num() > 0))
+	{
+		++TagGeneration;
+	}
+}
+
+void UUnifyGameplayTagsSubsystem::ScheduleTagExpiry(UUnifyGameplayTagsComponent* Component, const FGameplayTag& Tag, float Duration, uint32 Serial)
+{
+	const UWorld* World = GetWorld();
+	if (!Component || !Tag.IsValid() || !World)
+	{
+		return;
+	}
+
+	const double Now = World->GetTimeSeconds();
+	if (!bTagExpiryWheelStarted)
+	{
+		TagExpiryWheel.Reset(Now);
+		bTagExpiryWheelStarted = true;
+	}
+
+	FUnifyGameplayTagTimerWheel::FEntry Entry;
+	Entry.Component = Component;
+	Entry.Tag = Tag;
+	Entry.Serial = Serial;
+	TagExpiryWheel.Schedule(Now + Duration, MoveTemp(Entry));
+}
+
+int32 UUnifyGameplayTagsSubsystem::StartTimeSlicedTagQuery(const FGameplayTagContainer& Tags, TSubclassOf<AActor> ActorClass, FOnTimeSlicedTagQueryResults OnCompleted, FOnTimeSlicedTagQueryResults OnPartialResults)
+{
+	FTimeSlicedTagQuery& Query = TimeSlicedQueries.AddDefaulted_GetRef();
+	Query.QueryId = NextTimeSlicedQueryId++;
+	Query.Tags = Tags;
+	Query.ActorClass = ActorClass;
+	Query.OnCompleted = MoveTemp(OnCompleted);
+	Query.OnPartialResults = MoveTemp(OnPartialResults);
+
+	// Keep 0 free for "no query"
+	if (NextTimeSlicedQueryId <= 0)
+	{
+		NextTimeSlicedQueryId = 1;
+	}
+
+	return Query.QueryId;
+}
+
+bool UUnifyGameplayTagsSubsystem::CancelTimeSlicedTagQuery(int32 QueryId)
+{
+	return TimeSlicedQueries.RemoveAll([QueryId](const FTimeSlicedTagQuery& Query)
+	{
+		return Query.QueryId == QueryId;
+	}) > 0;
+}
+
+bool UUnifyGameplayTagsSubsystem::IsTimeSlicedTagQueryRunning(int32 QueryId) const
+{
+	return TimeSlicedQueries.ContainsByPredicate([QueryId](const FTimeSlicedTagQuery& Query)
+	{
+		return Query.QueryId == QueryId;
+	});
+}
+
+void UUnifyGameplayTagsSubsystem::ProcessTimeSlicedQueries()
+{
+	QUICK_SCOPE_CYCLE_COUNTER(UnifyGameplayTags_ProcessTimeSlicedQueries);
+
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+	const uint64 BudgetCycles = static_cast<uint64>(TimeSlicedQueryBudgetMicroseconds * 1e-6 / FPlatformTime::GetSecondsPerCycle64());
+
+	// Delegates are called once every query advanced, as they may start or cancel queries
+	TArray<TPair<int32, TArray<AActor*>>> PartialResults;
+	TArray<TPair<FOnTimeSlicedTagQueryResults, TArray<AActor*>>> CompletedResults;
+
+	int32 QueryIndex = 0;
+	while (QueryIndex < TimeSlicedQueries.Num())
+	{
+		FTimeSlicedTagQuery& Query = TimeSlicedQueries[QueryIndex];
+		const int32 FirstNewResult = Query.Results.Num();
+
+		// We do nothing if no tag is provided, rather than giving ALL actors!
+		if (Query.Tags.IsEmpty())
 		{
-			Result.Add(Component);
+			Query.Cursor = RegisteredComponents.Num();
 		}
+
+		// Visit components in slices. Each query gets its first slice of the frame even once the budget is spent,
+		// so queries behind a long one still make progress, further slices only run while budget remains.
+		while (Query.Cursor < RegisteredComponents.Num())
+		{
+			const int32 SliceEnd = FMath::Min(Query.Cursor + TimeSlicedQueryGranularity, RegisteredComponents.Num());
+			for (; Query.Cursor < SliceEnd; ++Query.Cursor)
+			{
+				const UUnifyGameplayTagsComponent* Component = RegisteredComponents[Query.Cursor];
+				if (Component && Component->HasAnyGameplayTagsNative(Query.Tags))
+				{
+					AActor* OwnerActor = Component->GetOwner();
+					if (OwnerActor && (!Query.ActorClass || OwnerActor->IsA(Query.ActorClass)))
+					{
+						Query.Results.Add(OwnerActor);
+					}
+				}
+			}
+
+			if (FPlatformTime::Cycles64() - StartCycles >= BudgetCycles)
+			{
+				break;
+			}
+		}
+
+		if (Query.Cursor >= RegisteredComponents.Num())
+		{
+			TArray<AActor*> Actors;
+			Actors.Reserve(Query.Results.Num());
+			for (const TWeakObjectPtr<AActor>& Result : Query.Results)
+			{
+				if (AActor* Actor = Result.Get())
+				{
+					Actors.Add(Actor);
+				}
+			}
+
+			CompletedResults.Emplace(MoveTemp(Query.OnCompleted), MoveTemp(Actors));
+			TimeSlicedQueries.RemoveAt(QueryIndex);
+			continue;
+		}
+
+		if (Query.OnPartialResults.IsBound() && Query.Results.Num() > FirstNewResult)
+		{
+			TArray<AActor*> Actors;
+			Actors.Reserve(Query.Results.Num() - FirstNewResult);
+			for (int32 ResultIndex = FirstNewResult; ResultIndex < Query.Results.Num(); ++ResultIndex)
+			{
+				if (AActor* Actor = Query.Results[ResultIndex].Get())
+				{
+					Actors.Add(Actor);
+				}
+			}
+			PartialResults.Emplace(Query.QueryId, MoveTemp(Actors));
+		}
+
+		++QueryIndex;
+	}
+
+	for (TPair<int32, TArray<AActor*>>& Partial : PartialResults)
+	{
+		// Skip queries cancelled by a previous delegate
+		const int32 QueryId = Partial.Key;
+		if (const FTimeSlicedTagQuery* Query = TimeSlicedQueries.FindByPredicate([QueryId](const FTimeSlicedTagQuery& Candidate) { return Candidate.QueryId == QueryId; }))
+		{
+			FOnTimeSlicedTagQueryResults OnPartialResults = Query->OnPartialResults;
+			OnPartialResults.ExecuteIfBound(Partial.Value);
+		}
+	}
+
+	for (TPair<FOnTimeSlicedTagQueryResults, TArray<AActor*>>& Completed : CompletedResults)
+	{
+		Completed.Key.ExecuteIfBound(Completed.Value);
 	}
-	return Result;
 }
 
-TArray<UUnifyGameplayTagsComponent*> UUnifyGameplayTagsSubsystem::GetComponentsWithAllTags(const FGameplayTagContainer& Tags) const
+void UUnifyGameplayTagsSubsystem::ProcessTagExpirations()
 {
-	TArray<UUnifyGameplayTagsComponent*> Result;
-	for (UUnifyGameplayTagsComponent* Component : RegisteredComponents)
+	const UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	TArray<FUnifyGameplayTagTimerWheel::FEntry> ExpiredEntries;
+	TagExpiryWheel.Advance(World->GetTimeSeconds(), ExpiredEntries);
+	if (ExpiredEntries.IsEmpty())
 	{
-		if (Component && Component->HasAllGameplayTags(Tags))
+		return;
+	}
+
+	// Group the expiries per component so each one emits a single coalesced delta this frame
+	Algo::StableSortBy(ExpiredEntries, [](const FUnifyGameplayTagTimerWheel::FEntry& Entry)
+	{
+		return Entry.Component.Get();
+	});
+
+	int32 RunStart = 0;
+	while (RunStart < ExpiredEntries.Num())
+	{
+		UUnifyGameplayTagsComponent* Component = ExpiredEntries[RunStart].Component.Get();
+		int32 RunEnd = RunStart + 1;
+		while (RunEnd < ExpiredEntries.Num() && ExpiredEntries[RunEnd].Component.Get() == Component)
 		{
-			Result.Add(Component);
+			++RunEnd;
+		}
+
+		if (Component)
+		{
+			FUnifyGameplayTagsBatchScope BatchScope(Component);
+			for (int32 EntryIndex = RunStart; EntryIndex < RunEnd; ++EntryIndex)
+			{
+				Component->HandleTimedTagExpired(ExpiredEntries[EntryIndex].Tag, ExpiredEntries[EntryIndex].Serial);
+			}
 		}
+
+		RunStart = RunEnd;
 	}
-	return Result;
 }
 
 void UUnifyGameplayTagsSubsystem::BindGameplayTagEvent(UObject* Listener, const FGameplayTag& EventTag, const FGameplayTagEventCallback& Callback, const FGameplayTagContainer& ListenerFilterTags)
@@ -137,13 +516,36 @@ void UUnifyGameplayTagsSubsystem::UnbindAllGameplayTagEvents(UObject* Listener,
 }
 
 void UUnifyGameplayTagsSubsystem::TriggerGameplayTagEvent(UObject* Dispatcher, const FGameplayTag EventTag, FGameplayTagMessageData Data, const FGameplayTagContainer EventPayloadTags)
+{
+	TArray<FGameplayTagEventListener> ListenersCopy;
+	DispatchGameplayTagEvent(Dispatcher, EventTag, Data, EventPayloadTags, ListenersCopy);
+}
+
+void UUnifyGameplayTagsSubsystem::TriggerGameplayTagEvents(UObject* Dispatcher, TConstArrayView<FGameplayTag> EventTags, const FGameplayTagMessageData& Data, const FGameplayTagContainer& EventPayloadTags)
+{
+	// A single scratch array is reused for every event of the batch
+	TArray<FGameplayTagEventListener> ListenersCopy;
+	for (const FGameplayTag& EventTag : EventTags)
+	{
+		DispatchGameplayTagEvent(Dispatcher, EventTag, Data, EventPayloadTags, ListenersCopy);
+	}
+}
+
+void UUnifyGameplayTagsSubsystem::DispatchGameplayTagEvent(UObject* Dispatcher, const FGameplayTag& EventTag, const FGameplayTagMessageData& Data, const FGameplayTagContainer& EventPayloadTags, TArray<FGameplayTagEventListener>& ListenersCopy)
 {
 	if (EventTag.IsValid())
 	{
+		// Record the event before dispatching it, replayed events are not recorded again
+		if (EventRecordWriter.IsValid() && !EventReplayReader.IsValid())
+		{
+			EventRecordWriter->WriteEvent(static_cast<uint32>(GFrameCounter - EventRecordStartFrame), EventTag, Dispatcher, Data, EventPayloadTags);
+		}
+
 		if (FGameplayTagEventListenerArrayWrapper* WrapperPtr = GameplayTagEventsMap.Find(EventTag))
 		{
-			// Create a copy of the listeners array to avoid issues if a callback modifies the original array (e.g., unbinds itself)
-			TArray<FGameplayTagEventListener> ListenersCopy = WrapperPtr->Listeners;
+			// Copy the listeners array to avoid issues if a callback modifies the original array (e.g., unbinds itself)
+			ListenersCopy.Reset();
+			ListenersCopy.Append(WrapperPtr->Listeners);
 			for (const FGameplayTagEventListener& ListenerEntry : ListenersCopy)
 			{
 				if (ListenerEntry.Callback.IsBound())
@@ -155,10 +557,140 @@ void UUnifyGameplayTagsSubsystem::TriggerGameplayTagEvent(UObject* Dispatcher, c
 
 					if (bFilterPassed)
 					{
-						ListenerEntry.Callback.ExecuteIfBound(Dispatcher, Data);
+						if (bCollectListenerTimings)
+						{
+							const uint64 StartCycles = FPlatformTime::Cycles64();
+							ListenerEntry.Callback.ExecuteIfBound(Dispatcher, Data);
+							const double ElapsedSeconds = FPlatformTime::ToSeconds64(FPlatformTime::Cycles64() - StartCycles);
+
+							const UObject* ListenerObject = ListenerEntry.Callback.GetUObject();
+							FGameplayTagEventListenerTiming& Timing = ListenerTimings.FindOrAdd(TPair<FGameplayTag, FObjectKey>(EventTag, FObjectKey(ListenerObject)));
+							if (Timing.NumCalls == 0)
+							{
+								Timing.ListenerName = GetNameSafe(ListenerObject);
+								Timing.EventTag = EventTag;
+							}
+							++Timing.NumCalls;
+							Timing.TotalSeconds += ElapsedSeconds;
+							Timing.MaxSeconds = FMath::Max(Timing.MaxSeconds, ElapsedSeconds);
+						}
+						else
+						{
+							ListenerEntry.Callback.ExecuteIfBound(Dispatcher, Data);
+						}
 					}
 				}
 			}
 		}
 	}
 }
+
+void UUnifyGameplayTagsSubsystem::StartEventRecording()
+{
+	EventRecordBuffer.Reset();
+	EventRecordWriter = MakeUnique<FUnifyGameplayTagEventRecordWriter>(EventRecordBuffer);
+	EventRecordStartFrame = GFrameCounter;
+}
+
+int32 UUnifyGameplayTagsSubsystem::StopEventRecording(TArray<uint8>& OutStream)
+{
+	if (!EventRecordWriter.IsValid())
+	{
+		OutStream.Reset();
+		return -1;
+	}
+
+	const int32 NumRecords = EventRecordWriter->GetNumRecords();
+	EventRecordWriter.Reset();
+	OutStream = MoveTemp(EventRecordBuffer);
+	EventRecordBuffer.Reset();
+	return NumRecords;
+}
+
+bool UUnifyGameplayTagsSubsystem::StartEventReplay(const TArray<uint8>& Stream, bool bMaxSpeed)
+{
+	StopEventReplay();
+
+	EventReplayBuffer = Stream;
+	EventReplayReader = MakeUnique<FUnifyGameplayTagEventRecordReader>(EventReplayBuffer);
+	if (!EventReplayReader->IsValid())
+	{
+		EventReplayReader.Reset();
+		EventReplayBuffer.Empty();
+		return false;
+	}
+
+	EventReplayStartFrame = GFrameCounter;
+	bReplayAtMaxSpeed = bMaxSpeed;
+	NumEventsReplayed = 0;
+	bHasPendingReplayRecord = false;
+	ListenerTimings.Reset();
+
+	// Events recorded on the first frame go out right away, the rest are paced by Tick
+	PumpEventReplay();
+	return true;
+}
+
+void UUnifyGameplayTagsSubsystem::StopEventReplay()
+{
+	EventReplayReader.Reset();
+	EventReplayBuffer.Empty();
+	bHasPendingReplayRecord = false;
+}
+
+TArray<FGameplayTagEventListenerTiming> UUnifyGameplayTagsSubsystem::GetEventReplayListenerTimings() const
+{
+	TArray<FGameplayTagEventListenerTiming> Result;
+	ListenerTimings.GenerateValueArray(Result);
+	Result.Sort([](const FGameplayTagEventListenerTiming& A, const FGameplayTagEventListenerTiming& B)
+	{
+		return A.TotalSeconds > B.TotalSeconds;
+	});
+	return Result;
+}
+
+void UUnifyGameplayTagsSubsystem::PumpEventReplay()
+{
+	const uint64 ReplayFrame = GFrameCounter - EventReplayStartFrame;
+
+	while (EventReplayReader.IsValid())
+	{
+		if (!bHasPendingReplayRecord)
+		{
+			if (!EventReplayReader->ReadNext(PendingReplayRecord))
+			{
+				FinishEventReplay();
+				return;
+			}
+			bHasPendingReplayRecord = true;
+		}
+
+		if (!bReplayAtMaxSpeed && PendingReplayRecord.Frame > ReplayFrame)
+		{
+			return;
+		}
+
+		bHasPendingReplayRecord = false;
+
+		FGameplayTagMessageData Data;
+		Data.SourceObject = PendingReplayRecord.SourceObjectPath.ResolveObject();
+		Data.Payload = MoveTemp(PendingReplayRecord.Payload);
+		Data.Tags = MoveTemp(PendingReplayRecord.MessageTags);
+
+		{
+			// Only the replayed dispatch is timed, live events fired between replayed ones are not
+			TGuardValue<bool> CollectTimingsGuard(bCollectListenerTimings, true);
+			TriggerGameplayTagEvent(PendingReplayRecord.DispatcherPath.ResolveObject(), PendingReplayRecord.EventTag, MoveTemp(Data), PendingReplayRecord.PayloadTags);
+		}
+		++NumEventsReplayed;
+	}
+}
+
+void UUnifyGameplayTagsSubsystem::FinishEventReplay()
+{
+	const int32 NumReplayed = NumEventsReplayed;
+	UE_LOG(LogGameplayTagExtension, Log, TEXT("Gameplay tag event replay finished, %d events dispatched to %d listeners."), NumReplayed, ListenerTimings.Num());
+
+	StopEventReplay();
+	OnEventReplayFinished.Broadcast(NumReplayed);
+}
@@ -0,0 +1,144 @@
+// Copyright 2025 Nguyen Phi Hung. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+
+/**
+ * Gameplay tag container keeping its explicit and parent tags in inline storage.
+ * Up to NumInlineTags explicit tags (and twice as many parent tags) are stored without any heap allocation,
+ * larger sets spill to the heap. Queries are linear scans over the inline arrays, which beats hashing for the
+ * handful of tags most actors carry. Converts to and from FGameplayTagContainer at API boundaries.
+ */
+template<int32 NumInlineTags>
+class TUnifyCompactGameplayTagContainer
+{
+public:
+	/**
+	 * Add an explicit tag and its parents
+	 * @return True if the tag was not already explicitly in the container
+	 */
+	bool AddTag(const FGameplayTag& TagToAdd)
+	{
+		if (!TagToAdd.IsValid() || ExplicitTags.Contains(TagToAdd))
+		{
+			return false;
+		}
+
+		ExplicitTags.Add(TagToAdd);
+		AddParentTags(TagToAdd);
+		return true;
+	}
+
+	/**
+	 * Remove an explicit tag
+	 * @param bDeferParentTags If true, the caller is responsible for calling FillParentTags
+	 * @return True if the tag was explicitly in the container
+	 */
+	bool RemoveTag(const FGameplayTag& TagToRemove, bool bDeferParentTags = false)
+	{
+		if (ExplicitTags.RemoveSingle(TagToRemove) == 0)
+		{
+			return false;
+		}
+
+		if (!bDeferParentTags)
+		{
+			FillParentTags();
+		}
+		return true;
+	}
+
+	/** Rebuild the parent tags from the explicit tags */
+	void FillParentTags()
+	{
+		ParentTags.Reset();
+		for (const FGameplayTag& Tag : ExplicitTags)
+		{
+			AddParentTags(Tag);
+		}
+	}
+
+	/** Remove every tag, keeping the inline storage */
+	void Reset()
+	{
+		ExplicitTags.Reset();
+		ParentTags.Reset();
+	}
+
+	/** Check if the tag or one of its children is in the container */
+	bool HasTag(const FGameplayTag& TagToCheck) const
+	{
+		return TagToCheck.IsValid() && (ExplicitTags.Contains(TagToCheck) || ParentTags.Contains(TagToCheck));
+	}
+
+	/** Check if the tag is explicitly in the container */
+	bool HasTagExact(const FGameplayTag& TagToCheck) const
+	{
+		return TagToCheck.IsValid() && ExplicitTags.Contains(TagToCheck);
+	}
+
+	/** Same semantics as FGameplayTagContainer::HasAny */
+	bool HasAny(const FGameplayTagContainer& ContainerToCheck) const
+	{
+		for (const FGameplayTag& Tag : ContainerToCheck)
+		{
+			if (HasTag(Tag))
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	/** Same semantics as FGameplayTagContainer::HasAll */
+	bool HasAll(const FGameplayTagContainer& ContainerToCheck) const
+	{
+		for (const FGameplayTag& Tag : ContainerToCheck)
+		{
+			if (!HasTag(Tag))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	/** Replace the content of this container with the tags of a regular container */
+	void FromContainer(const FGameplayTagContainer& Container)
+	{
+		ExplicitTags.Reset();
+		ExplicitTags.Append(Container.GetGameplayTagArray());
+		FillParentTags();
+	}
+
+	/** Build a regular container holding the same tags */
+	FGameplayTagContainer ToContainer() const
+	{
+		FGameplayTagContainer Result;
+		for (const FGameplayTag& Tag : ExplicitTags)
+		{
+			Result.AddTagFast(Tag);
+		}
+		return Result;
+	}
+
+	/** Get the explicit tags of the container */
+	TArrayView<const FGameplayTag> GetExplicitTags() const { return ExplicitTags; }
+
+	int32 Num() const { return ExplicitTags.Num(); }
+	bool IsEmpty() const { return ExplicitTags.IsEmpty(); }
+
+private:
+	void AddParentTags(const FGameplayTag& Tag)
+	{
+		for (FGameplayTag ParentTag = Tag.RequestDirectParent(); ParentTag.IsValid(); ParentTag = ParentTag.RequestDirectParent())
+		{
+			ParentTags.AddUnique(ParentTag);
+		}
+	}
+
+	TArray<FGameplayTag, TInlineAllocator<NumInlineTags>> ExplicitTags;
+	TArray<FGameplayTag, TInlineAllocator<NumInlineTags * 2>> ParentTags;
+};
@@ -0,0 +1,113 @@
+// Copyright 2025 Nguyen Phi Hung. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "StructUtils/InstancedStruct.h"
+#include "UObject/SoftObjectPath.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/ObjectAndNameAsStringProxyArchive.h"
+
+struct FGameplayTagMessageData;
+
+/**
+ * A single gameplay tag event as stored in a recording stream
+ */
+struct GAMEPLAYTAGEXTENSION_API FUnifyGameplayTagEventRecord
+{
+	/** Frame the event was triggered on, relative to the start of the recording */
+	uint32 Frame = 0;
+
+	/** The gameplay tag that identifies the event */
+	FGameplayTag EventTag;
+
+	/** Path of the object that dispatched the event */
+	FSoftObjectPath DispatcherPath;
+
+	/** Path of the message source object */
+	FSoftObjectPath SourceObjectPath;
+
+	/** Payload of the message, empty if the payload struct could not be resolved on read */
+	FInstancedStruct Payload;
+
+	/** Tags carried by the message data */
+	FGameplayTagContainer MessageTags;
+
+	/** Tags used to filter the listeners of the event */
+	FGameplayTagContainer PayloadTags;
+};
+
+/**
+ * Writes gameplay tag events to a compact binary stream.
+ * Tag names, object paths and struct paths are written once and referenced by index afterwards,
+ * frames are delta encoded and payloads are size prefixed so unknown struct types can be skipped on read.
+ */
+class GAMEPLAYTAGEXTENSION_API FUnifyGameplayTagEventRecordWriter
+{
+public:
+	explicit FUnifyGameplayTagEventRecordWriter(TArray<uint8>& InBuffer);
+
+	/**
+	 * Append an event to the stream
+	 * @param Frame Frame of the event relative to the start of the recording
+	 * @param EventTag The gameplay tag that identifies the event
+	 * @param Dispatcher The object that dispatched the event
+	 * @param Data The message data of the event
+	 * @param PayloadTags Tags used to filter the listeners of the event
+	 */
+	void WriteEvent(uint32 Frame, const FGameplayTag& EventTag, const UObject* Dispatcher, const FGameplayTagMessageData& Data, const FGameplayTagContainer& PayloadTags);
+
+	/** Number of events written so far */
+	int32 GetNumRecords() const { return NumRecords; }
+
+private:
+	void WriteTableEntry(FArchive& Ar, const FString& Value);
+	void WriteTags(FArchive& Ar, const FGameplayTagContainer& Tags);
+
+	FMemoryWriter MemoryWriter;
+	FObjectAndNameAsStringProxyArchive Archive;
+
+	/** Reused buffer for serializing payloads before they are size prefixed */
+	TArray<uint8> PayloadScratch;
+
+	TMap<FString, uint32> StringTable;
+	uint32 LastFrame = 0;
+	int32 NumRecords = 0;
+};
+
+/**
+ * Reads gameplay tag events back from a stream produced by FUnifyGameplayTagEventRecordWriter
+ */
+class GAMEPLAYTAGEXTENSION_API FUnifyGameplayTagEventRecordReader
+{
+public:
+	explicit FUnifyGameplayTagEventRecordReader(const TArray<uint8>& InBuffer);
+
+	/** Whether the stream header was recognised */
+	bool IsValid() const { return bValid; }
+
+	/** Whether every record of the stream has been read */
+	bool AtEnd() const;
+
+	/**
+	 * Read the next record of the stream
+	 * @param OutRecord The record to fill
+	 * @return False if the stream is exhausted or corrupted
+	 */
+	bool ReadNext(FUnifyGameplayTagEventRecord& OutRecord);
+
+private:
+	bool ReadTableEntry(FArchive& Ar, FString& OutValue);
+	bool ReadTags(FArchive& Ar, FGameplayTagContainer& OutTags);
+
+	FMemoryReader MemoryReader;
+	FObjectAndNameAsStringProxyArchive Archive;
+
+	TArray<uint8> PayloadScratch;
+
+	TArray<FString> StringTable;
+	uint32 LastFrame = 0;
+	bool bValid = false;
+};
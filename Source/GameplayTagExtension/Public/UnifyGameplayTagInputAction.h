@@ -9,6 +9,7 @@
 
 class UInputAction;
 class UObject;
+class UUnifyGameplayTagInputConfig;
 
 USTRUCT(BlueprintType)
 struct FUnifyGameplayTagInputAction
@@ -24,6 +25,59 @@ public:
 	FGameplayTag InputTag;
 };
 
+/**
+ * Hashed lookup between input tags and input actions, in both directions.
+ * Built by each input config on load, and can merge several configs into one table used at runtime.
+ */
+struct GAMEPLAYTAGEXTENSION_API FUnifyGameplayTagInputLookup
+{
+	/**
+	 * Build a single table from several configs
+	 * @param Configs The configs to merge, earlier configs take precedence on conflicting entries
+	 */
+	static FUnifyGameplayTagInputLookup Merge(TConstArrayView<const UUnifyGameplayTagInputConfig*> Configs);
+
+	/** Remove every entry */
+	void Reset();
+
+	/**
+	 * Add the native input actions of a config, entries already in the table take precedence
+	 * @param Config The config to add
+	 */
+	void AddConfig(const UUnifyGameplayTagInputConfig* Config);
+
+	/**
+	 * Add a single mapping, ignored if the tag or the action is already mapped
+	 * @param InputAction The input action
+	 * @param InputTag The tag of the input action
+	 */
+	void Add(const UInputAction* InputAction, const FGameplayTag& InputTag);
+
+	/** Find the input action mapped to a tag, null if there is none */
+	const UInputAction* FindActionForTag(const FGameplayTag& InputTag) const
+	{
+		const UInputAction* const* Found = TagToAction.Find(InputTag);
+		return Found ? *Found : nullptr;
+	}
+
+	/** Find the tag mapped to an input action, invalid if there is none */
+	FGameplayTag FindTagForAction(const UInputAction* InputAction) const
+	{
+		const FGameplayTag* Found = ActionToTag.Find(InputAction);
+		return Found ? *Found : FGameplayTag();
+	}
+
+	/** Get every input action and its tag */
+	const TMap<const UInputAction*, FGameplayTag>& GetActionToTagMap() const { return ActionToTag; }
+
+	int32 Num() const { return ActionToTag.Num(); }
+
+private:
+	/** The actions are kept alive by the configs the table was built from */
+	TMap<FGameplayTag, const UInputAction*> TagToAction;
+	TMap<const UInputAction*, FGameplayTag> ActionToTag;
+};
+
 UCLASS(BlueprintType, Const)
 class UUnifyGameplayTagInputConfig : public UDataAsset
 {
@@ -33,9 +87,27 @@ public:
 
 	UUnifyGameplayTagInputConfig(const FObjectInitializer& ObjectInitializer);
 
+	// Begin UObject interface
+	virtual void PostLoad() override;
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+	// End UObject interface
+
+	/** Find the input action mapped to a tag, a miss is only logged the first time for each tag */
 	UFUNCTION(BlueprintCallable, Category = "UnifyGameplayTag")
 	const UInputAction* FindNativeInputActionForTag(const FGameplayTag& InputTag, bool bLogNotFound = true) const;
 
+	/** Find the tag mapped to an input action, a miss is only logged the first time for each action */
+	UFUNCTION(BlueprintCallable, Category = "UnifyGameplayTag")
+	FGameplayTag FindInputTagForNativeInputAction(const UInputAction* InputAction, bool bLogNotFound = true) const;
+
+	/** Rebuild the lookup table, required after modifying NativeInputActions at runtime */
+	void RebuildInputLookup();
+
+	/** Get the lookup table built from NativeInputActions */
+	const FUnifyGameplayTagInputLookup& GetInputLookup() const;
+
 	// UFUNCTION(BlueprintCallable, Category = "UnifyGameplayTag")
 	// const UInputAction* FindAbilityInputActionForTag(const FGameplayTag& InputTag, bool bLogNotFound = true) const;
 
@@ -47,4 +119,13 @@ public:
 	// List of input actions used by the owner.  These input actions are mapped to a gameplay tag and are automatically bound to abilities with matching input tags.
 	// UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Meta = (TitleProperty = "InputAction"))
 	// TArray<FLyraInputAction> AbilityInputActions;
+
+private:
+	/** Lookup table built from NativeInputActions */
+	mutable FUnifyGameplayTagInputLookup InputLookup;
+	mutable bool bInputLookupDirty = true;
+
+	/** Misses that were already logged */
+	mutable TSet<FGameplayTag> LoggedMissingTags;
+	mutable TSet<const UInputAction*> LoggedMissingActions;
 };
\ No newline at end of file
@@ -0,0 +1,70 @@
+// Copyright 2025 Nguyen Phi Hung. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "GameplayTagContainer.h"
+#include "InputTriggers.h"
+#include "UnifyGameplayTagInputAction.h"
+#include "UnifyGameplayTagInputRouterComponent.generated.h"
+
+class UInputComponent;
+class UEnhancedInputComponent;
+
+/**
+ * Routes Enhanced Input actions into the gameplay tag event bus.
+ * Every input action of the configs is bound once, the tag of the action is carried by the binding itself.
+ * Inputs triggered during a frame are queued and dispatched through UUnifyGameplayTagsSubsystem as one batch,
+ * the event tag being the input tag and the source object of the message being the owner of this component.
+ */
+UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent), BlueprintType)
+class GAMEPLAYTAGEXTENSION_API UUnifyGameplayTagInputRouterComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	UUnifyGameplayTagInputRouterComponent();
+
+	// Begin UActorComponent interface
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+	// End UActorComponent interface
+
+	/**
+	 * Bind the input actions of the configs to an input component, replacing any previous binding
+	 * Called on BeginPlay with the input component of the owner, call it again when the owner gets a new input component (e.g. on possession)
+	 * @param InputComponent The input component to bind to, must be an enhanced input component
+	 */
+	UFUNCTION(BlueprintCallable, Category = "GameplayTags|Input")
+	void BindInputComponent(UInputComponent* InputComponent);
+
+	/** Remove every binding made by this component */
+	UFUNCTION(BlueprintCallable, Category = "GameplayTags|Input")
+	void UnbindInputComponent();
+
+	/** The configs to route, earlier configs take precedence when several map the same action or tag */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "GameplayTags|Input")
+	TArray<TObjectPtr<const UUnifyGameplayTagInputConfig>> InputConfigs;
+
+	/** The trigger events that are routed to the event bus */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "GameplayTags|Input")
+	TArray<ETriggerEvent> RoutedTriggerEvents = { ETriggerEvent::Triggered };
+
+private:
+	/** Queue an input for the batch dispatched this frame */
+	void HandleInputTag(FGameplayTag InputTag);
+
+	/** Dispatch the queued inputs */
+	void FlushInputTags();
+
+	/** The input component the actions are bound to */
+	TWeakObjectPtr<UEnhancedInputComponent> BoundInputComponent;
+
+	/** Handles of the bindings, used to remove them */
+	TArray<uint32> BindingHandles;
+
+	/** Inputs triggered this frame, in trigger order. Capacity is kept between frames */
+	TArray<FGameplayTag> PendingInputTags;
+};
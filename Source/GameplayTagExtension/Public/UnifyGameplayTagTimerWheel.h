@@ -0,0 +1,81 @@
+// Copyright 2025 Nguyen Phi Hung. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "UObject/WeakObjectPtr.h"
+
+class UUnifyGameplayTagsComponent;
+
+/**
+ * Hierarchical timer wheel tracking the expiry of timed gameplay tags.
+ * Time is quantized into ticks, and each level of the wheel covers 64 times the range of the level below.
+ * Scheduling is O(1), and advancing by one tick only touches the due slot plus, when a level wraps, the slot cascaded from the level above.
+ */
+class GAMEPLAYTAGEXTENSION_API FUnifyGameplayTagTimerWheel
+{
+public:
+	/** A scheduled tag expiry */
+	struct FEntry
+	{
+		/** The component the tag was added to */
+		TWeakObjectPtr<UUnifyGameplayTagsComponent> Component;
+
+		/** The tag to remove on expiry */
+		FGameplayTag Tag;
+
+		/** Serial used by the component to discard expiries that were refreshed or cancelled */
+		uint32 Serial = 0;
+
+		/** Tick the entry expires on */
+		uint64 ExpiryTick = 0;
+	};
+
+	/**
+	 * @param InTickSeconds Duration of a tick, the resolution of the wheel
+	 */
+	explicit FUnifyGameplayTagTimerWheel(double InTickSeconds = 1.0 / 60.0);
+
+	/**
+	 * Remove every entry and restart the wheel at the given time
+	 * @param Time The time the wheel starts at, in seconds
+	 */
+	void Reset(double Time);
+
+	/**
+	 * Schedule the expiry of a tag
+	 * @param ExpiryTime The time the tag expires at, in seconds
+	 * @param Entry The entry to schedule, its ExpiryTick is overwritten
+	 */
+	void Schedule(double ExpiryTime, FEntry&& Entry);
+
+	/**
+	 * Advance the wheel, collecting every entry that expired on the way
+	 * @param Time The time to advance to, in seconds
+	 * @param OutExpired Array the expired entries are appended to, in expiry order
+	 */
+	void Advance(double Time, TArray<FEntry>& OutExpired);
+
+	/** Number of scheduled entries */
+	int32 Num() const { return NumEntries; }
+
+private:
+	static constexpr int32 NumLevels = 4;
+	static constexpr int32 SlotBits = 6;
+	static constexpr int32 NumSlots = 1 << SlotBits;
+	static constexpr uint64 SlotMask = NumSlots - 1;
+
+	/** First tick ending at or after the time, the tick an entry expiring at that time is processed on */
+	uint64 TimeToExpiryTick(double Time) const;
+
+	/** Last tick fully elapsed at the time */
+	uint64 TimeToElapsedTick(double Time) const;
+	void Insert(FEntry&& Entry);
+
+	TArray<FEntry> Slots[NumLevels][NumSlots];
+	double TickSeconds;
+	double StartTime = 0.0;
+	uint64 CurrentTick = 0;
+	int32 NumEntries = 0;
+};
@@ -0,0 +1,60 @@
+// Copyright 2025 Nguyen Phi Hung. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "Kismet/BlueprintAsyncActionBase.h"
+#include "UnifyGameplayTagsAsyncQueryAction.generated.h"
+
+class UUnifyGameplayTagsSubsystem;
+
+/**
+ * Delegate broadcast with the actors matched by a time-sliced query.
+ */
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FUnifyGameplayTagsAsyncQueryResults, const TArray<AActor*>&, Actors);
+
+/**
+ * Latent version of GetAllActorsOfClassWithGameplayTags, spreading the scan of the registered components over several frames
+ * within the budget set on UUnifyGameplayTagsSubsystem.
+ */
+UCLASS()
+class GAMEPLAYTAGEXTENSION_API UUnifyGameplayTagsAsyncQueryAction : public UBlueprintAsyncActionBase
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * Get all actors of class with any of the gameplay tags, without stalling the frame on large worlds
+	 * @param ActorClass Optional class the matched actors must be of
+	 * @param bStreamPartialResults If true, OnPartialResults is broadcast every frame with the actors matched during that frame
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Actor", meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject"))
+	static UUnifyGameplayTagsAsyncQueryAction* GetAllActorsOfClassWithGameplayTagsTimeSliced(const UObject* WorldContextObject, TSubclassOf<AActor> ActorClass, const FGameplayTagContainer TagsToCheck, bool bStreamPartialResults = false);
+
+	/** Cancel the query, no further pin is triggered */
+	UFUNCTION(BlueprintCallable, Category = "Actor")
+	void Cancel();
+
+	// Begin UBlueprintAsyncActionBase interface
+	virtual void Activate() override;
+	// End UBlueprintAsyncActionBase interface
+
+	/** Actors matched during the last frame, only broadcast when streaming partial results */
+	UPROPERTY(BlueprintAssignable)
+	FUnifyGameplayTagsAsyncQueryResults OnPartialResults;
+
+	/** Every matched actor, broadcast once the query completed */
+	UPROPERTY(BlueprintAssignable)
+	FUnifyGameplayTagsAsyncQueryResults OnCompleted;
+
+private:
+	void HandlePartialResults(TConstArrayView<AActor*> Actors);
+	void HandleCompleted(TConstArrayView<AActor*> Actors);
+
+	TWeakObjectPtr<UUnifyGameplayTagsSubsystem> Subsystem;
+	TSubclassOf<AActor> ActorClass;
+	FGameplayTagContainer TagsToCheck;
+	bool bStreamPartialResults = false;
+	int32 QueryId = 0;
+};
@@ -7,6 +7,7 @@
 #include "GameplayTagContainer.h"
 #include "UnifyGameplayTagsInterface.h"
 #include "UnifyGameplayTagsSubsystem.h"
+#include "UnifyCompactGameplayTagContainer.h"
 #include "UnifyGameplayTagsComponent.generated.h"
 
 
@@ -52,6 +53,43 @@ public:
 	virtual void ClearGameplayTags_Implementation() override;
 	// End IUnifyGameplayTagsInterface
 
+	/**
+	 * Native read-only view of the tag container, for internal C++ use.
+	 * Unlike GetGameplayTagContainer this does not copy and ignores Blueprint overrides.
+	 * With compact storage the view is materialized on demand, prefer the Has* queries in that mode.
+	 */
+	FORCEINLINE const FGameplayTagContainer& GetOwnedGameplayTags() const
+	{
+		return CompactStorage ? GetCompactTagMirror() : GameplayTagContainer;
+	}
+
+	/**
+	 * Native tag queries for internal hot loops. They skip the interface thunks and read the container directly,
+	 * unless the component class overrides the queries in Blueprint, in which case the override is called instead.
+	 */
+	FORCEINLINE FGameplayTagContainer GetGameplayTagContainerNative() const
+	{
+		return bHasBlueprintTagQueries ? Execute_GetGameplayTagContainer(this) : (CompactStorage ? CompactStorage->Tags.ToContainer() : GameplayTagContainer);
+	}
+
+	FORCEINLINE bool HasGameplayTagNative(const FGameplayTag& TagToCheck) const
+	{
+		return bHasBlueprintTagQueries ? Execute_HasGameplayTag(this, TagToCheck) : HasTagInternal(TagToCheck);
+	}
+
+	FORCEINLINE bool HasAllGameplayTagsNative(const FGameplayTagContainer& TagsToCheck) const
+	{
+		return bHasBlueprintTagQueries ? Execute_HasAllGameplayTags(this, TagsToCheck) : HasAllTagsInternal(TagsToCheck);
+	}
+
+	FORCEINLINE bool HasAnyGameplayTagsNative(const FGameplayTagContainer& TagsToCheck) const
+	{
+		return bHasBlueprintTagQueries ? Execute_HasAnyGameplayTags(this, TagsToCheck) : HasAnyTagsInternal(TagsToCheck);
+	}
+
+	/** Whether the tag queries of this component class are overridden in Blueprint */
+	bool HasBlueprintTagQueries() const { return bHasBlueprintTagQueries; }
+
 	/** 
 	 * Delegate signature for tag container change events
 	 * @param TagContainer The new tag container
@@ -63,11 +101,97 @@ public:
 	UPROPERTY(BlueprintAssignable, Category = "GameplayTags")
 	FOnTagContainerChanged OnGameplayTagContainerChanged;
 
+	/**
+	 * Delegate signature for tag delta events
+	 * @param AddedTags The tags that were added by the change
+	 * @param RemovedTags The tags that were removed by the change
+	 */
+	DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnTagContainerDelta, const FGameplayTagContainer&, AddedTags, const FGameplayTagContainer&, RemovedTags);
+
+	/** Delegate that is broadcast with only the tags added and removed by a change. Not broadcast for no-op changes. */
+	UPROPERTY(BlueprintAssignable, Category = "GameplayTags")
+	FOnTagContainerDelta OnGameplayTagsDelta;
+
+	/**
+	 * Native delegate signature for tag delta events. The views are only valid for the duration of the broadcast.
+	 * @param Component The component whose tags changed
+	 * @param AddedTags The tags that were added by the change
+	 * @param RemovedTags The tags that were removed by the change
+	 */
+	DECLARE_MULTICAST_DELEGATE_ThreeParams(FOnTagDeltaNative, UUnifyGameplayTagsComponent*, TArrayView<const FGameplayTag>, TArrayView<const FGameplayTag>);
+
+	/** Native delegate that is broadcast with only the tags added and removed by a change, without copying the container */
+	FOnTagDeltaNative OnGameplayTagsDeltaNative;
+
+	/**
+	 * Native delegate signature for single tag change events
+	 * @param Tag The tag the event was registered for
+	 * @param bPresent Whether the tag, or one of its children for events registered with bIncludeChildren, is present after the change
+	 */
+	DECLARE_MULTICAST_DELEGATE_TwoParams(FOnGameplayTagChangedNative, const FGameplayTag, bool);
+
+	/**
+	 * Get the event broadcast when a specific tag is added or removed. Only changes touching the tag invoke it.
+	 * @param Tag The tag to listen for
+	 * @param bIncludeChildren If true, the event is also broadcast when a child of the tag is added or removed
+	 * @return The event to add delegates to
+	 */
+	FOnGameplayTagChangedNative& RegisterTagChangedEvent(const FGameplayTag& Tag, bool bIncludeChildren = false);
+
+	/**
+	 * Remove a delegate from an event returned by RegisterTagChangedEvent
+	 * @param Tag The tag the event was registered for
+	 * @param bIncludeChildren The value passed to RegisterTagChangedEvent
+	 * @param Handle The handle returned when the delegate was added
+	 */
+	void UnregisterTagChangedEvent(const FGameplayTag& Tag, bool bIncludeChildren, FDelegateHandle Handle);
+
 	/** Delegate that is broadcast when receiving a gameplay tag event */
 	UPROPERTY(BlueprintAssignable, Category = "GameplayTags|Events")
 	FGameplayTagEventMulticast OnGameplayTagEventReceived;
 
+	/**
+	 * Begin a batch of tag changes. Notifications and subsystem updates are deferred until the matching
+	 * EndGameplayTagBatch, which emits a single coalesced delta. Batches can be nested.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "GameplayTags")
+	void BeginGameplayTagBatch();
+
+	/** End a batch of tag changes started with BeginGameplayTagBatch, flushing the coalesced delta when the outermost batch ends */
+	UFUNCTION(BlueprintCallable, Category = "GameplayTags")
+	void EndGameplayTagBatch();
+
+	/**
+	 * Add a tag that is removed automatically once the duration elapsed, driven by the subsystem timer wheel.
+	 * In counted mode every call pushes a stack that expires on its own, otherwise adding the tag again refreshes the duration.
+	 * An explicit removal pops the top stack and cancels its expiry if it was timed, so the expiry never pops a stack it doesn't own.
+	 * @param TagToAdd The tag to add
+	 * @param Duration Seconds of game time the tag stays on the component, the tag is permanent if not positive
+	 */
+	UFUNCTION(BlueprintCallable, Category = "GameplayTags")
+	void AddGameplayTagWithDuration(const FGameplayTag& TagToAdd, float Duration);
+
+	/**
+	 * Called by the subsystem when a timed tag expires
+	 * @param Tag The expired tag
+	 * @param Serial The serial the expiry was scheduled with
+	 */
+	void HandleTimedTagExpired(const FGameplayTag& Tag, uint32 Serial);
+
+	/**
+	 * Get the number of stacks of a tag
+	 * @param Tag The tag to count, matched exactly
+	 * @return The stack count in counted mode, otherwise 1 if the tag is present and 0 if not
+	 */
+	UFUNCTION(BlueprintPure, Category = "GameplayTags")
+	int32 GetGameplayTagCount(const FGameplayTag& Tag) const;
+
+	/** Whether tag notifications are currently deferred by a batch */
+	UFUNCTION(BlueprintPure, Category = "GameplayTags")
+	bool IsInGameplayTagBatch() const { return TagBatchDepth > 0; }
+
 	// Begin UActorComponent interface
+	virtual void OnRegister() override;
 	virtual void BeginPlay() override;
 	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	// End UActorComponent interface
@@ -77,6 +201,63 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "GameplayTags")
 	FGameplayTagContainer GameplayTagContainer;
 
+	/**
+	 * If true, tags are reference counted: each add pushes a stack and each remove pops one,
+	 * and the tag only leaves the container (and notifies) when its last stack is removed
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "GameplayTags")
+	bool bUseTagCounts = false;
+
+	/**
+	 * If true, tags are kept in inline storage sized for a few tags instead of the heap-allocated container.
+	 * In game worlds, tags authored in GameplayTagContainer seed the compact storage on register and the property is emptied:
+	 * read the current tags through GetGameplayTagContainer at runtime rather than through the property.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "GameplayTags")
+	bool bUseCompactTagStorage = false;
+
+	/** Number of explicit tags the compact storage holds before spilling to the heap */
+	static constexpr int32 NumInlineGameplayTags = 8;
+
+	/** State of the compact mode, kept out of line so components that don't use it only pay for a pointer */
+	struct FCompactTagStorage
+	{
+		/** Tag storage used instead of GameplayTagContainer */
+		TUnifyCompactGameplayTagContainer<NumInlineGameplayTags> Tags;
+
+		/** Container materialized from the compact storage for GetOwnedGameplayTags, rebuilt when dirty */
+		FGameplayTagContainer Mirror;
+		bool bMirrorDirty = false;
+	};
+
+	/** Compact storage, created when it is seeded from the authored tags on register in a game world. Tags live in GameplayTagContainer while it is null. */
+	TUniquePtr<FCompactTagStorage> CompactStorage;
+
+	/** Stack count of each explicit tag, only maintained in counted mode */
+	TMap<FGameplayTag, int32> TagCounts;
+
+	/** Serial of the pending expiry of each timed tag, only used outside of counted mode */
+	TMap<FGameplayTag, uint32> TimedTagSerials;
+	uint32 NextTimedTagSerial = 0;
+
+	/** A stack of a tag pushed by AddGameplayTagWithDuration in counted mode, live until it expires or is removed explicitly */
+	struct FTimedTagStack
+	{
+		uint32 Serial;
+
+		/** Position of the stack among all the stacks of the tag, explicit removals pop the top one */
+		int32 StackIndex;
+	};
+
+	/** Live timed stacks of each tag in push order, only used in counted mode. An expiry only pops a stack whose serial is still listed. */
+	TMap<FGameplayTag, TArray<FTimedTagStack>> TimedTagStacks;
+
+	/** Events broadcast when the exact tag is added or removed */
+	TMap<FGameplayTag, FOnGameplayTagChangedNative> ExactTagChangedEvents;
+
+	/** Events broadcast when the tag or one of its children is added or removed */
+	TMap<FGameplayTag, FOnGameplayTagChangedNative> ChildTagChangedEvents;
+
 	/** The tag channel to listen to and broadcast on */
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "GameplayTags|Message", meta = (DisplayName = "GameplayTag Event Tag"))
 	FGameplayTag GameplayMessageTag;
@@ -112,9 +293,108 @@ protected:
 	 */
 	void UpdateEventBinding(bool bForceRebind = false);
 
+	/** Queries against whichever storage the component uses */
+	FORCEINLINE bool HasTagInternal(const FGameplayTag& Tag) const
+	{
+		return CompactStorage ? CompactStorage->Tags.HasTag(Tag) : GameplayTagContainer.HasTag(Tag);
+	}
+
+	FORCEINLINE bool HasTagExactInternal(const FGameplayTag& Tag) const
+	{
+		return CompactStorage ? CompactStorage->Tags.HasTagExact(Tag) : GameplayTagContainer.HasTagExact(Tag);
+	}
+
+	FORCEINLINE bool HasAllTagsInternal(const FGameplayTagContainer& Tags) const
+	{
+		return CompactStorage ? CompactStorage->Tags.HasAll(Tags) : GameplayTagContainer.HasAll(Tags);
+	}
+
+	FORCEINLINE bool HasAnyTagsInternal(const FGameplayTagContainer& Tags) const
+	{
+		return CompactStorage ? CompactStorage->Tags.HasAny(Tags) : GameplayTagContainer.HasAny(Tags);
+	}
+
+	/** Explicit tags of whichever storage the component uses */
+	FORCEINLINE TArrayView<const FGameplayTag> GetExplicitTagsInternal() const
+	{
+		return CompactStorage ? CompactStorage->Tags.GetExplicitTags() : TArrayView<const FGameplayTag>(GameplayTagContainer.GetGameplayTagArray());
+	}
+
+	/** Get the container mirroring the compact storage, rebuilding it if the storage changed */
+	const FGameplayTagContainer& GetCompactTagMirror() const;
+
+	/**
+	 * Adds a tag to the explicit container, pushing a stack in counted mode
+	 * @return True if the explicit container changed
+	 */
+	bool AddTagInternal(const FGameplayTag& Tag);
+
+	/**
+	 * Removes a tag from the explicit container, popping a stack in counted mode
+	 * @param bDeferParentTags If true, the caller is responsible for calling FillParentTags on the container
+	 * @return True if the explicit container changed
+	 */
+	bool RemoveTagInternal(const FGameplayTag& Tag, bool bDeferParentTags);
+
+	/** Resets every tag count to a single stack of each explicit tag */
+	void ResetTagCountsFromContainer();
+
+	/**
+	 * Broadcasts the per-tag events registered for the changed tags and their parents
+	 * @param AddedTags The tags that were added
+	 * @param RemovedTags The tags that were removed
+	 */
+	void BroadcastTagChangedEvents(TArrayView<const FGameplayTag> AddedTags, TArrayView<const FGameplayTag> RemovedTags);
+
+	/** 
+	 * Broadcasts a change of the tag container to the delta and container delegates
+	 * @param AddedTags The tags that were added by the change
+	 * @param RemovedTags The tags that were removed by the change
+	 * @param ChangeType The operation that caused the change
+	 * @param BroadcastContainer Container passed to OnGameplayTagContainerChanged, the current container if null
+	 */
+	void NotifyGameplayTagsChanged(TArrayView<const FGameplayTag> AddedTags, TArrayView<const FGameplayTag> RemovedTags, ETagChangeType ChangeType, const FGameplayTagContainer* BroadcastContainer = nullptr);
+
+	/** Broadcasts the coalesced delta of the batch and resets it, called when the outermost batch ends or the component ends play */
+	void FlushGameplayTagBatch();
+
+	/** Whether the tag queries of this component class are overridden in Blueprint, computed on every register so recompiled Blueprints are picked up. Assumed until known. */
+	uint8 bHasBlueprintTagQueries : 1;
+
+	/** Subsystem this component is registered with */
+	TWeakObjectPtr<UUnifyGameplayTagsSubsystem> RegisteredSubsystem;
+
+	/** Nesting depth of the open tag batches */
+	int32 TagBatchDepth = 0;
+
+	/** Net tags added and removed since the outermost batch began */
+	TArray<FGameplayTag> PendingAddedTags;
+	TArray<FGameplayTag> PendingRemovedTags;
+
+	/** Change type reported when the batch is flushed, Set if the batch mixed operations */
+	TOptional<ETagChangeType> PendingChangeType;
+
+	/** Container from before the first clear of the batch, broadcast instead of the current one when the batch only cleared */
+	TOptional<FGameplayTagContainer> PendingBroadcastContainer;
+
 	/** The last tag we were bound to */
 	FGameplayTag LastBoundMessageTag;
 	
 	/** The current event tag we're bound to */
 	FGameplayTag CurrentEventTag;
 };
+
+/**
+ * Defers the tag notifications of a component for the lifetime of the scope, then emits a single coalesced delta.
+ * Scopes can be nested, only the outermost one flushes.
+ */
+struct GAMEPLAYTAGEXTENSION_API FUnifyGameplayTagsBatchScope
+{
+	explicit FUnifyGameplayTagsBatchScope(UUnifyGameplayTagsComponent* InComponent);
+	~FUnifyGameplayTagsBatchScope();
+
+	UE_NONCOPYABLE(FUnifyGameplayTagsBatchScope);
+
+private:
+	TWeakObjectPtr<UUnifyGameplayTagsComponent> Component;
+};
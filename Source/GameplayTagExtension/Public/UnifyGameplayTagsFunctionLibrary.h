@@ -54,8 +54,51 @@ public:
     UFUNCTION(BlueprintCallable, Category = "GameplayTags", meta = (WorldContext = "WorldContextObject"))
     static void RunGameplayTagOperationOnActor(const UObject* WorldContextObject, const AActor* Actor, const FGameplayTagContainer Tags, ETagChangeType OperationType, FGameplayTagContainer& OutContainer, bool& bSuccess);
 
+    /**
+     * Run set/add/remove/clear on many actors at once. Components are resolved once and every component
+     * is notified with a single coalesced delta after all of them were modified.
+     * @param OutSuccess One entry per actor, false for actors without a gameplay tag component
+     * @return Number of actors the operation was applied to
+     */
+    UFUNCTION(BlueprintCallable, Category = "GameplayTags", meta = (WorldContext = "WorldContextObject"))
+    static int32 RunGameplayTagOperationOnActors(const UObject* WorldContextObject, const TArray<AActor*>& Actors, const FGameplayTagContainer Tags, ETagChangeType OperationType, TArray<bool>& OutSuccess);
+
+    /**
+     * Check many actors for gameplay tags with enum check type of any or exact. Large arrays are evaluated in parallel.
+     * @param OutResults One entry per actor, false for actors without a gameplay tag component
+     * @return Number of actors passing the check
+     */
+    UFUNCTION(BlueprintCallable, Category = "GameplayTags", meta = (WorldContext = "WorldContextObject"))
+    static int32 AreActorsHasGameplayTags(const UObject* WorldContextObject, const TArray<AActor*>& Actors, const FGameplayTagContainer TagsToCheck, EGameplayTagCheckType CheckType, TArray<bool>& OutResults);
+
+    /**
+     * Same as AreActorsHasGameplayTags, packing the results into a bitmask
+     * @param OutMask Bit (Index % 32) of word (Index / 32) is set if the actor at Index passes the check
+     * @return Number of actors passing the check
+     */
+    UFUNCTION(BlueprintCallable, Category = "GameplayTags", meta = (WorldContext = "WorldContextObject"))
+    static int32 GetActorsHasGameplayTagsMask(const UObject* WorldContextObject, const TArray<AActor*>& Actors, const FGameplayTagContainer TagsToCheck, EGameplayTagCheckType CheckType, TArray<int32>& OutMask);
+
     /** create event dispatched on actor on gameplaytag change*/
 protected:
+	/** Minimum number of actors for read-only batch checks to be evaluated in parallel */
+	static constexpr int32 ParallelTagCheckThreshold = 256;
+
+	/**
+	 * Resolve the gameplay tag component of every actor
+	 * @param bOutHasBlueprintQueries Set to true if any resolved component overrides its tag queries in Blueprint
+	 */
+	static void ResolveGameplayTagComponents(const UObject* WorldContextObject, const TArray<AActor*>& Actors, TArray<UUnifyGameplayTagsComponent*>& OutComponents, bool& bOutHasBlueprintQueries);
+
+	/**
+	 * Resolve the gameplay tag component of an actor through the subsystem cache,
+	 * falling back to a component scan for actors without a registered component
+	 */
+	static UUnifyGameplayTagsComponent* FindGameplayTagComponent(const AActor* Actor, const UUnifyGameplayTagsSubsystem* Subsystem);
+
+	/** Get the subsystem of the world an actor belongs to */
+	static UUnifyGameplayTagsSubsystem* GetActorGameplayTagsSubsystem(const AActor* Actor);
+
 	static UUnifyGameplayTagsSubsystem* GetUnifyGameplayTagsSubsystem()
 	{
 		if (
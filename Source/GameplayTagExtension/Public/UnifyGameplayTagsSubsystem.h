@@ -5,7 +5,10 @@
 #include "CoreMinimal.h"
 #include "GameplayTags.h"
 #include "UnifyGameplayTagsInterface.h"
+#include "UnifyGameplayTagEventRecorder.h"
+#include "UnifyGameplayTagTimerWheel.h"
 #include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
 #include "UnifyGameplayTagsSubsystem.generated.h"
 
 class UUnifyGameplayTagsComponent;
@@ -63,12 +66,51 @@ struct FGameplayTagEventListenerArrayWrapper
 	{}
 };
 
+/**
+ * Time spent by a single listener handling a gameplay tag event, collected while replaying recorded events
+ */
+USTRUCT(BlueprintType)
+struct FGameplayTagEventListenerTiming
+{
+	GENERATED_BODY()
+
+	/** Name of the listening object */
+	UPROPERTY(BlueprintReadOnly, Category = "GameplayTags|Events")
+	FString ListenerName;
+
+	/** The event the listener was bound to */
+	UPROPERTY(BlueprintReadOnly, Category = "GameplayTags|Events")
+	FGameplayTag EventTag;
+
+	/** Number of times the listener was called */
+	UPROPERTY(BlueprintReadOnly, Category = "GameplayTags|Events")
+	int32 NumCalls = 0;
+
+	/** Accumulated time spent in the listener, in seconds */
+	UPROPERTY(BlueprintReadOnly, Category = "GameplayTags|Events")
+	double TotalSeconds = 0.0;
+
+	/** Longest single call of the listener, in seconds */
+	UPROPERTY(BlueprintReadOnly, Category = "GameplayTags|Events")
+	double MaxSeconds = 0.0;
+};
+
+/**
+ * Delegate broadcast when a replay of recorded gameplay tag events has dispatched its last event.
+ */
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnGameplayTagEventReplayFinished, int32, NumEventsReplayed);
+
+/**
+ * Delegate receiving the actors matched by a time-sliced tag query, either the ones found during a frame or the full result on completion.
+ */
+DECLARE_DELEGATE_OneParam(FOnTimeSlicedTagQueryResults, TConstArrayView<AActor*> /*Actors*/);
+
 /**
  * World subsystem for managing UnifyGameplayTags components and global gameplay tag events
  * Provides a central registry for UnifyGameplayTagsComponents in the world and a global event system using GameplayTags
  */
 UCLASS()
-class GAMEPLAYTAGEXTENSION_API UUnifyGameplayTagsSubsystem : public UWorldSubsystem
+class GAMEPLAYTAGEXTENSION_API UUnifyGameplayTagsSubsystem : public UTickableWorldSubsystem
 {
 	GENERATED_BODY()
 
@@ -80,6 +122,11 @@ public:
 	virtual void Deinitialize() override;
 	// End USubsystem interface
 
+	// Begin FTickableGameObject interface
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	// End FTickableGameObject interface
+
 #pragma region Component Management
 	/**
 	 * Register a component with the subsystem
@@ -99,6 +146,17 @@ public:
 	 */
 	TArray<UUnifyGameplayTagsComponent*> GetRegisteredComponents() const { return RegisteredComponents; }
 
+	/**
+	 * Find the registered component owned by an actor
+	 * @param Actor The actor to look up
+	 * @return The registered component of the actor, or null if the actor has none registered
+	 */
+	UUnifyGameplayTagsComponent* FindComponentForActor(const AActor* Actor) const
+	{
+		UUnifyGameplayTagsComponent* const* Found = ActorComponentMap.Find(Actor);
+		return Found ? *Found : nullptr;
+	}
+
 	/**
 	 * Get all components with a specific gameplay tag
 	 * @param Tag The gameplay tag to check for
@@ -119,6 +177,81 @@ public:
 	 * @return Array of components that have all of the specified tags
 	 */
 	TArray<UUnifyGameplayTagsComponent*> GetComponentsWithAllTags(const FGameplayTagContainer& Tags) const;
+
+	/**
+	 * Enable or disable the per-frame cache of GetComponentsWith* results
+	 * While enabled, identical queries in the same frame return a copy of the first result as long as no tag or registration changed in between.
+	 * Queries are not cached while a registered component overrides the tag queries in Blueprint, as its answers can change without notice.
+	 * @param bEnabled Whether results are cached
+	 */
+	UFUNCTION(BlueprintCallable, Category = "GameplayTags")
+	void SetTagQueryCacheEnabled(bool bEnabled);
+
+	/** Whether GetComponentsWith* results are cached for the rest of the frame */
+	UFUNCTION(BlueprintPure, Category = "GameplayTags")
+	bool IsTagQueryCacheEnabled() const { return bTagQueryCacheEnabled; }
+
+	/**
+	 * Called by registered components when their explicit tags changed, once per coalesced change: right away outside of a batch,
+	 * when the outermost batch ends otherwise. The subsystem keeps no per-tag index, the tag generation is the only state it maintains here.
+	 * @param Component The component whose tags changed
+	 * @param AddedTags The tags that were added
+	 * @param RemovedTags The tags that were removed
+	 */
+	void NotifyComponentTagsChanged(UUnifyGameplayTagsComponent* Component, TArrayView<const FGameplayTag> AddedTags, TArrayView<const FGameplayTag> RemovedTags);
+
+	/** Called by registered components for each change made inside a batch, only moves the tag generation so cached queries don't return the tags from before the change */
+	void MarkComponentTagsDirty() { ++TagGeneration; }
+
+	/**
+	 * Get the world tag generation
+	 * @return Counter incremented whenever the registry or the tags of a registered component change
+	 */
+	uint32 GetTagGeneration() const { return TagGeneration; }
+
+	/**
+	 * Schedule the removal of a timed tag on the central timer wheel
+	 * @param Component The component the tag was added to
+	 * @param Tag The tag to remove on expiry
+	 * @param Duration Seconds of game time until the tag expires
+	 * @param Serial Passed back to the component on expiry so it can discard refreshed or cancelled timers
+	 */
+	void ScheduleTagExpiry(UUnifyGameplayTagsComponent* Component, const FGameplayTag& Tag, float Duration, uint32 Serial);
+#pragma endregion
+
+#pragma region Time Sliced Queries
+	/**
+	 * Start a query over every registered component that is spread over several frames, within the per-frame budget
+	 * Components registered while the query runs are visited, components unregistered before being visited are skipped.
+	 * Each component is tested against its tags at the time it is visited.
+	 * @param Tags The query matches actors with any of these tags
+	 * @param ActorClass Optional class the matched actors must be of
+	 * @param OnCompleted Called with every matched actor once the whole registry was visited, or with the actors matched so far if the subsystem shuts down first
+	 * @param OnPartialResults Optional, called at the end of each frame with the actors matched during that frame
+	 * @return Id of the query, used to cancel it
+	 */
+	int32 StartTimeSlicedTagQuery(const FGameplayTagContainer& Tags, TSubclassOf<AActor> ActorClass, FOnTimeSlicedTagQueryResults OnCompleted, FOnTimeSlicedTagQueryResults OnPartialResults = FOnTimeSlicedTagQueryResults());
+
+	/**
+	 * Cancel a time-sliced query without calling its delegates
+	 * @param QueryId Id returned by StartTimeSlicedTagQuery
+	 * @return False if the query was not running
+	 */
+	bool CancelTimeSlicedTagQuery(int32 QueryId);
+
+	/** Whether a time-sliced query is still running */
+	bool IsTimeSlicedTagQueryRunning(int32 QueryId) const;
+
+	/**
+	 * Set the time all time-sliced queries may spend per frame
+	 * @param BudgetMicroseconds The budget shared by the running queries, in microseconds. Every running query still advances by at least one slice per frame
+	 */
+	UFUNCTION(BlueprintCallable, Category = "GameplayTags")
+	void SetTimeSlicedQueryBudget(float BudgetMicroseconds) { TimeSlicedQueryBudgetMicroseconds = FMath::Max(BudgetMicroseconds, 0.f); }
+
+	/** Get the time all time-sliced queries may spend per frame, in microseconds */
+	UFUNCTION(BlueprintPure, Category = "GameplayTags")
+	float GetTimeSlicedQueryBudget() const { return TimeSlicedQueryBudgetMicroseconds; }
 #pragma endregion
 
 #pragma region Event System
@@ -163,12 +296,191 @@ public:
 	 */
 	UFUNCTION(BlueprintCallable, Category = "GameplayTags|Events", meta = (DefaultToSelf = "Dispatcher", HidePin = "Dispatcher"))
 	void TriggerGameplayTagEvent(UObject* Dispatcher, const FGameplayTag EventTag, FGameplayTagMessageData Data, const FGameplayTagContainer EventPayloadTags = FGameplayTagContainer());
+
+	/**
+	 * Trigger several gameplay tag events sharing the same message, in order
+	 * @param Dispatcher The object that is dispatching the events
+	 * @param EventTags The gameplay tags that identify the events
+	 * @param Data Data passed to the listeners of every event
+	 * @param EventPayloadTags Tags used to filter the listeners of every event
+	 */
+	void TriggerGameplayTagEvents(UObject* Dispatcher, TConstArrayView<FGameplayTag> EventTags, const FGameplayTagMessageData& Data, const FGameplayTagContainer& EventPayloadTags = FGameplayTagContainer());
+#pragma endregion
+
+#pragma region Event Recording
+	/**
+	 * Start recording every triggered gameplay tag event to a binary stream
+	 * Any recording already in progress is discarded
+	 */
+	UFUNCTION(BlueprintCallable, Category = "GameplayTags|Events|Recording")
+	void StartEventRecording();
+
+	/**
+	 * Stop the current recording
+	 * @param OutStream The recorded event stream
+	 * @return Number of recorded events, or -1 if no recording was in progress
+	 */
+	UFUNCTION(BlueprintCallable, Category = "GameplayTags|Events|Recording")
+	int32 StopEventRecording(TArray<uint8>& OutStream);
+
+	/** Whether triggered events are currently being recorded */
+	UFUNCTION(BlueprintPure, Category = "GameplayTags|Events|Recording")
+	bool IsRecordingEvents() const { return EventRecordWriter.IsValid(); }
+
+	/**
+	 * Replay a recorded event stream through the event bus, collecting the time spent in each listener
+	 * @param Stream The stream produced by StopEventRecording
+	 * @param bMaxSpeed If true, every event is dispatched immediately, otherwise events are dispatched on their recorded frame offsets
+	 * @return False if the stream could not be read
+	 */
+	UFUNCTION(BlueprintCallable, Category = "GameplayTags|Events|Recording")
+	bool StartEventReplay(const TArray<uint8>& Stream, bool bMaxSpeed);
+
+	/** Stop the current replay without dispatching the remaining events */
+	UFUNCTION(BlueprintCallable, Category = "GameplayTags|Events|Recording")
+	void StopEventReplay();
+
+	/** Whether a recorded event stream is currently being replayed */
+	UFUNCTION(BlueprintPure, Category = "GameplayTags|Events|Recording")
+	bool IsReplayingEvents() const { return EventReplayReader.IsValid(); }
+
+	/** Get the listener timings collected by the last replay, for the replayed events only */
+	UFUNCTION(BlueprintCallable, Category = "GameplayTags|Events|Recording")
+	TArray<FGameplayTagEventListenerTiming> GetEventReplayListenerTimings() const;
+
+	/** Delegate broadcast when a replay has dispatched its last event */
+	UPROPERTY(BlueprintAssignable, Category = "GameplayTags|Events|Recording")
+	FOnGameplayTagEventReplayFinished OnEventReplayFinished;
 #pragma endregion
 
 private:
+	/** A query started by StartTimeSlicedTagQuery */
+	struct FTimeSlicedTagQuery
+	{
+		int32 QueryId = 0;
+		FGameplayTagContainer Tags;
+		TSubclassOf<AActor> ActorClass;
+
+		/** Index of the next registered component to visit */
+		int32 Cursor = 0;
+
+		/** Owners of the matched components, weak as they may be destroyed before the query completes */
+		TArray<TWeakObjectPtr<AActor>> Results;
+
+		FOnTimeSlicedTagQueryResults OnCompleted;
+		FOnTimeSlicedTagQueryResults OnPartialResults;
+	};
+
+	/** Kind of query stored in the tag query cache */
+	enum class ETagQueryCacheType : uint8
+	{
+		Tag,
+		Any,
+		All
+	};
+
+	/** Key of the tag query cache, the hash ignores the order of the tags like the container equality does */
+	struct FTagQueryCacheKey
+	{
+		FTagQueryCacheKey(ETagQueryCacheType InQueryType, const FGameplayTagContainer& InTags);
+
+		bool operator==(const FTagQueryCacheKey& Other) const
+		{
+			return Hash == Other.Hash && QueryType == Other.QueryType && Tags == Other.Tags;
+		}
+
+		friend uint32 GetTypeHash(const FTagQueryCacheKey& Key) { return Key.Hash; }
+
+		FGameplayTagContainer Tags;
+		ETagQueryCacheType QueryType;
+		uint32 Hash;
+	};
+
+	/** Run a query over the registered components, going through the tag query cache when it is enabled */
+	template<typename PredicateType>
+	TArray<UUnifyGameplayTagsComponent*> RunCachedTagQuery(ETagQueryCacheType QueryType, const FGameplayTagContainer& Tags, PredicateType&& Predicate) const;
+
+	/** Drop the cached query results at the end of every frame */
+	void HandleEndFrame();
+
+	/** Number of components visited between two budget checks */
+	static constexpr int32 TimeSlicedQueryGranularity = 32;
+
+	/**
+	 * Record and dispatch a single event
+	 * @param ListenersCopy Scratch array the listeners are copied to before being called
+	 */
+	void DispatchGameplayTagEvent(UObject* Dispatcher, const FGameplayTag& EventTag, const FGameplayTagMessageData& Data, const FGameplayTagContainer& EventPayloadTags, TArray<FGameplayTagEventListener>& ListenersCopy);
+
+	/** Advance the time-sliced queries within the frame budget and notify their delegates */
+	void ProcessTimeSlicedQueries();
+
+	/** Advance the timer wheel to the current world time and remove the expired tags */
+	void ProcessTagExpirations();
+
+	/** Dispatch the recorded events due at the current replay frame, or all of them when replaying at max speed */
+	void PumpEventReplay();
+
+	/** Finish the current replay and notify listeners of OnEventReplayFinished */
+	void FinishEventReplay();
+
+	/** Writer of the recording in progress, null when not recording */
+	TUniquePtr<FUnifyGameplayTagEventRecordWriter> EventRecordWriter;
+
+	/** Buffer the recording in progress is written to */
+	TArray<uint8> EventRecordBuffer;
+
+	/** Frame the recording in progress was started on */
+	uint64 EventRecordStartFrame = 0;
+
+	/** Reader of the replay in progress, null when not replaying */
+	TUniquePtr<FUnifyGameplayTagEventRecordReader> EventReplayReader;
+
+	/** Buffer the replay in progress is read from */
+	TArray<uint8> EventReplayBuffer;
+
+	/** The next record to dispatch, read ahead of its frame */
+	FUnifyGameplayTagEventRecord PendingReplayRecord;
+	bool bHasPendingReplayRecord = false;
+
+	/** Frame the replay in progress was started on */
+	uint64 EventReplayStartFrame = 0;
+	bool bReplayAtMaxSpeed = false;
+	int32 NumEventsReplayed = 0;
+
+	/** Whether listener calls are timed, only set while a replayed event is dispatched */
+	bool bCollectListenerTimings = false;
+
+	/** Listener timings keyed by event tag and listener object */
+	TMap<TPair<FGameplayTag, FObjectKey>, FGameplayTagEventListenerTiming> ListenerTimings;
+
 	/** Array of registered components */
 	TArray<UUnifyGameplayTagsComponent*> RegisteredComponents;
 
+	/** Registered component of each actor, filled on registration to avoid scanning actor components */
+	TMap<const AActor*, UUnifyGameplayTagsComponent*> ActorComponentMap;
+
+	/** Counter incremented whenever the registry or the tags of a registered component change */
+	uint32 TagGeneration = 0;
+
+	/** Number of registered components overriding the tag queries in Blueprint, the query cache is bypassed while there are any */
+	int32 NumBlueprintQueryComponents = 0;
+
+	/** Results of the queries run this frame, only valid for TagQueryCacheGeneration */
+	mutable TMap<FTagQueryCacheKey, TArray<UUnifyGameplayTagsComponent*>> TagQueryCache;
+	mutable uint32 TagQueryCacheGeneration = 0;
+	bool bTagQueryCacheEnabled = false;
+	FDelegateHandle EndFrameHandle;
+
+	/** Running time-sliced queries, advanced in start order */
+	TArray<FTimeSlicedTagQuery> TimeSlicedQueries;
+	int32 NextTimeSlicedQueryId = 1;
+	float TimeSlicedQueryBudgetMicroseconds = 500.f;
+
+	/** Expiry of every timed tag in the world, advanced once per frame */
+	FUnifyGameplayTagTimerWheel TagExpiryWheel;
+	bool bTagExpiryWheelStarted = false;
+
 	/** Map that stores the Gameplay Tag Events */
 	/** Map that stores arrays of gameplay tag event listeners, keyed by event tag. */
 	UPROPERTY()
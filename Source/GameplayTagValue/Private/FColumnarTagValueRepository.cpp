@@ -0,0 +1,307 @@
+// Copyright Nguyen Phi Hung 2025. All Rights Reserved.
+
+#include "FColumnarTagValueRepository.h" // Corresponding header
+
+
+FColumnarTagValueRepository::FColumnarTagValueRepository(FName InRepositoryName, int32 InPriority)
+    : RepositoryName(InRepositoryName)
+    , Priority(InPriority)
+{
+}
+
+bool FColumnarTagValueRepository::GetValue(FGameplayTag Tag, FInstancedStruct& OutValue) const
+{
+    if (const FSlot* Slot = Slots.Find(Tag))
+    {
+        BoxValue(*Slot, OutValue);
+        return true;
+    }
+    return false;
+}
+
+void FColumnarTagValueRepository::SetValue(FGameplayTag Tag, const FInstancedStruct& InValue)
+{
+    if (Tag.IsValid() && AssignValue(Tag, InValue))
+    {
+        NotifyChanged(Tag);
+    }
+}
+
+void FColumnarTagValueRepository::SetValues(TConstArrayView<FGameplayTag> Tags, TConstArrayView<FInstancedStruct> InValues)
+{
+    Slots.Reserve(Slots.Num() + Tags.Num());
+    SetValuesBatched(Tags, InValues,
+        [this](FGameplayTag Tag, const FInstancedStruct& InValue) { return AssignValue(Tag, InValue); },
+        [this](FGameplayTag Tag) { NotifyChanged(Tag); });
+}
+
+bool FColumnarTagValueRepository::HasValue(FGameplayTag Tag) const
+{
+    return Slots.Contains(Tag);
+}
+
+void FColumnarTagValueRepository::ClearValue(FGameplayTag Tag)
+{
+    FSlot Slot;
+    if (Slots.RemoveAndCopyValue(Tag, Slot))
+    {
+        RemoveFromColumn(Slot);
+        NotifyChanged(Tag);
+    }
+}
+
+void FColumnarTagValueRepository::ClearAllValues()
+{
+    Slots.Empty();
+    Floats = TColumn<float>();
+    Ints = TColumn<int32>();
+    Bools = TColumn<bool>();
+    Vectors = TColumn<FVector>();
+    Structs = TColumn<FInstancedStruct>();
+    NotifyChanged(FGameplayTag());
+}
+
+FName FColumnarTagValueRepository::GetRepositoryName() const
+{
+    return RepositoryName;
+}
+
+int32 FColumnarTagValueRepository::GetRepositoryPriority() const
+{
+    return Priority;
+}
+
+uint32 FColumnarTagValueRepository::GetRepositoryVersion() const
+{
+    return *Version;
+}
+
+TSharedPtr<const uint32> FColumnarTagValueRepository::GetRepositoryVersionCounter() const
+{
+    return Version;
+}
+
+const FInstancedStruct* FColumnarTagValueRepository::FindValue(FGameplayTag Tag) const
+{
+    const FSlot* Slot = Slots.Find(Tag);
+    if (!Slot)
+    {
+        return nullptr;
+    }
+    if (Slot->Column == EColumn::Struct)
+    {
+        return &Structs.Values[Slot->Index];
+    }
+
+    TUniquePtr<FInstancedStruct>& Boxed = BoxedValues.FindOrAdd(Tag);
+    if (!Boxed.IsValid())
+    {
+        Boxed = MakeUnique<FInstancedStruct>();
+        BoxValue(*Slot, *Boxed);
+    }
+    return Boxed.Get();
+}
+
+void FColumnarTagValueRepository::GetAllTags(TArray<FGameplayTag>& OutTags) const
+{
+    OutTags.Reserve(OutTags.Num() + Slots.Num());
+    for (const TPair<FGameplayTag, FSlot>& Pair : Slots)
+    {
+        OutTags.Add(Pair.Key);
+    }
+}
+
+FOnTagValueRepositoryChanged& FColumnarTagValueRepository::OnRepositoryChanged()
+{
+    return RepositoryChangedDelegate;
+}
+
+bool FColumnarTagValueRepository::GetFloat(FGameplayTag Tag, float& OutValue) const
+{
+    return GetTyped(Floats, EColumn::Float, Tag, OutValue);
+}
+
+bool FColumnarTagValueRepository::GetInt(FGameplayTag Tag, int32& OutValue) const
+{
+    return GetTyped(Ints, EColumn::Int, Tag, OutValue);
+}
+
+bool FColumnarTagValueRepository::GetBool(FGameplayTag Tag, bool& OutValue) const
+{
+    return GetTyped(Bools, EColumn::Bool, Tag, OutValue);
+}
+
+bool FColumnarTagValueRepository::GetVector(FGameplayTag Tag, FVector& OutValue) const
+{
+    return GetTyped(Vectors, EColumn::Vector, Tag, OutValue);
+}
+
+void FColumnarTagValueRepository::SetFloat(FGameplayTag Tag, float InValue)
+{
+    SetTyped(Floats, EColumn::Float, Tag, InValue);
+}
+
+void FColumnarTagValueRepository::SetInt(FGameplayTag Tag, int32 InValue)
+{
+    SetTyped(Ints, EColumn::Int, Tag, InValue);
+}
+
+void FColumnarTagValueRepository::SetBool(FGameplayTag Tag, bool InValue)
+{
+    SetTyped(Bools, EColumn::Bool, Tag, InValue);
+}
+
+void FColumnarTagValueRepository::SetVector(FGameplayTag Tag, const FVector& InValue)
+{
+    SetTyped(Vectors, EColumn::Vector, Tag, InValue);
+}
+
+template<typename T>
+bool FColumnarTagValueRepository::GetTyped(const TColumn<T>& Column, EColumn ColumnType, FGameplayTag Tag, T& OutValue) const
+{
+    const FSlot* Slot = Slots.Find(Tag);
+    if (Slot && Slot->Column == ColumnType)
+    {
+        OutValue = Column.Values[Slot->Index];
+        return true;
+    }
+    return false;
+}
+
+bool FColumnarTagValueRepository::AssignValue(FGameplayTag Tag, const FInstancedStruct& InValue)
+{
+    if (!InValue.IsValid())
+    {
+        // Same outcome as FMemoryTagValueRepository, where an invalid value is reported as no value
+        FSlot Slot;
+        if (!Slots.RemoveAndCopyValue(Tag, Slot))
+        {
+            return false;
+        }
+        RemoveFromColumn(Slot);
+        return true;
+    }
+
+    // Only the exact scalar types go to the typed columns, derived structs keep their full type
+    const UScriptStruct* ScriptStruct = InValue.GetScriptStruct();
+    if (ScriptStruct == FTagValueFloat::StaticStruct())
+    {
+        AssignTyped(Floats, EColumn::Float, Tag, InValue.Get<FTagValueFloat>().Value);
+    }
+    else if (ScriptStruct == FTagValueInt::StaticStruct())
+    {
+        AssignTyped(Ints, EColumn::Int, Tag, InValue.Get<FTagValueInt>().Value);
+    }
+    else if (ScriptStruct == FTagValueBool::StaticStruct())
+    {
+        AssignTyped(Bools, EColumn::Bool, Tag, InValue.Get<FTagValueBool>().Value);
+    }
+    else if (ScriptStruct == FTagValueVector::StaticStruct())
+    {
+        AssignTyped(Vectors, EColumn::Vector, Tag, InValue.Get<FTagValueVector>().Value);
+    }
+    else
+    {
+        AssignTyped(Structs, EColumn::Struct, Tag, InValue);
+    }
+    return true;
+}
+
+template<typename T>
+void FColumnarTagValueRepository::SetTyped(TColumn<T>& Column, EColumn ColumnType, FGameplayTag Tag, const T& InValue)
+{
+    if (Tag.IsValid())
+    {
+        AssignTyped(Column, ColumnType, Tag, InValue);
+        NotifyChanged(Tag);
+    }
+}
+
+template<typename T>
+void FColumnarTagValueRepository::AssignTyped(TColumn<T>& Column, EColumn ColumnType, FGameplayTag Tag, const T& InValue)
+{
+    FSlot* Slot = Slots.Find(Tag);
+    if (Slot && Slot->Column == ColumnType)
+    {
+        Column.Values[Slot->Index] = InValue;
+    }
+    else
+    {
+        // A tag changing type moves to the column of its new type
+        if (Slot)
+        {
+            RemoveFromColumn(*Slot);
+        }
+        Column.Tags.Add(Tag);
+        Slots.Add(Tag, FSlot{ ColumnType, Column.Values.Add(InValue) });
+    }
+}
+
+template<typename T>
+void FColumnarTagValueRepository::RemoveAt(TColumn<T>& Column, int32 Index)
+{
+    Column.Values.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+    Column.Tags.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+
+    // The last value took the place of the removed one
+    if (Index < Column.Tags.Num())
+    {
+        Slots.FindChecked(Column.Tags[Index]).Index = Index;
+    }
+}
+
+void FColumnarTagValueRepository::RemoveFromColumn(const FSlot& Slot)
+{
+    switch (Slot.Column)
+    {
+    case EColumn::Float:
+        RemoveAt(Floats, Slot.Index);
+        break;
+    case EColumn::Int:
+        RemoveAt(Ints, Slot.Index);
+        break;
+    case EColumn::Bool:
+        RemoveAt(Bools, Slot.Index);
+        break;
+    case EColumn::Vector:
+        RemoveAt(Vectors, Slot.Index);
+        break;
+    case EColumn::Struct:
+        RemoveAt(Structs, Slot.Index);
+        break;
+    }
+}
+
+void FColumnarTagValueRepository::BoxValue(const FSlot& Slot, FInstancedStruct& OutValue) const
+{
+    switch (Slot.Column)
+    {
+    case EColumn::Float:
+        OutValue.InitializeAs<FTagValueFloat>();
+        OutValue.GetMutable<FTagValueFloat>().Value = Floats.Values[Slot.Index];
+        break;
+    case EColumn::Int:
+        OutValue.InitializeAs<FTagValueInt>();
+        OutValue.GetMutable<FTagValueInt>().Value = Ints.Values[Slot.Index];
+        break;
+    case EColumn::Bool:
+        OutValue.InitializeAs<FTagValueBool>();
+        OutValue.GetMutable<FTagValueBool>().Value = Bools.Values[Slot.Index];
+        break;
+    case EColumn::Vector:
+        OutValue.InitializeAs<FTagValueVector>();
+        OutValue.GetMutable<FTagValueVector>().Value = Vectors.Values[Slot.Index];
+        break;
+    case EColumn::Struct:
+        OutValue = Structs.Values[Slot.Index];
+        break;
+    }
+}
+
+void FColumnarTagValueRepository::NotifyChanged(FGameplayTag Tag)
+{
+    // Boxed values only live as long as the version they were boxed for, like views into the columns
+    BoxedValues.Reset();
+    ++(*Version);
+    RepositoryChangedDelegate.Broadcast(*this, Tag);
+}
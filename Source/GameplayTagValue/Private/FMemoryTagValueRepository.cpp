@@ -36,9 +36,15 @@ void FMemoryTagValueRepository::SetValue(FGameplayTag Tag, const FInstancedStruc
         // Current behavior: an invalid InValue will emplace an invalid FInstancedStruct, GetValue/HasValue will report false.
     }
     TagValues.Emplace(Tag, InValue);
+    NotifyChanged(Tag);
     // UE_LOG(LogGameplayTagValue, Verbose, TEXT("Tag '%s' set in repository '%s'."), *Tag.ToString(), *RepositoryName.ToString());
 }
 
+void FMemoryTagValueRepository::SetValues(TConstArrayView<FGameplayTag> Tags, TConstArrayView<FInstancedStruct> InValues)
+{
+    SetValuesInMap(TagValues, Tags, InValues, [this](FGameplayTag Tag) { NotifyChanged(Tag); });
+}
+
 bool FMemoryTagValueRepository::HasValue(FGameplayTag Tag) const
 {
     const FInstancedStruct* FoundValue = TagValues.Find(Tag);
@@ -47,13 +53,17 @@ bool FMemoryTagValueRepository::HasValue(FGameplayTag Tag) const
 
 void FMemoryTagValueRepository::ClearValue(FGameplayTag Tag)
 {
-    TagValues.Remove(Tag);
+    if (TagValues.Remove(Tag) > 0)
+    {
+        NotifyChanged(Tag);
+    }
     // UE_LOG(LogGameplayTagValue, Verbose, TEXT("Tag '%s' cleared from repository '%s'."), *Tag.ToString(), *RepositoryName.ToString());
 }
 
 void FMemoryTagValueRepository::ClearAllValues()
 {
     TagValues.Empty();
+    NotifyChanged(FGameplayTag());
     // UE_LOG(LogGameplayTagValue, Verbose, TEXT("All values cleared from repository '%s'."), *RepositoryName.ToString());
 }
 
@@ -66,3 +76,42 @@ int32 FMemoryTagValueRepository::GetRepositoryPriority() const
 {
     return Priority;
 }
+
+uint32 FMemoryTagValueRepository::GetRepositoryVersion() const
+{
+    return *Version;
+}
+
+TSharedPtr<const uint32> FMemoryTagValueRepository::GetRepositoryVersionCounter() const
+{
+    return Version;
+}
+
+const FInstancedStruct* FMemoryTagValueRepository::FindValue(FGameplayTag Tag) const
+{
+    const FInstancedStruct* FoundValue = TagValues.Find(Tag);
+    return FoundValue && FoundValue->IsValid() ? FoundValue : nullptr;
+}
+
+void FMemoryTagValueRepository::GetAllTags(TArray<FGameplayTag>& OutTags) const
+{
+    OutTags.Reserve(OutTags.Num() + TagValues.Num());
+    for (const TPair<FGameplayTag, FInstancedStruct>& Pair : TagValues)
+    {
+        if (Pair.Value.IsValid())
+        {
+            OutTags.Add(Pair.Key);
+        }
+    }
+}
+
+FOnTagValueRepositoryChanged& FMemoryTagValueRepository::OnRepositoryChanged()
+{
+    return RepositoryChangedDelegate;
+}
+
+void FMemoryTagValueRepository::NotifyChanged(FGameplayTag Tag)
+{
+    ++(*Version);
+    RepositoryChangedDelegate.Broadcast(*this, Tag);
+}
@@ -3,15 +3,52 @@
 #include "GameplayTagValueSubsystem.h"
 #include "GameplayTagValue.h" // For LogGameplayTagValue
 #include "FMemoryTagValueRepository.h" // For the default internal repository
+#include "FColumnarTagValueRepository.h" // For the columnar default repository
 #include "UObject/UObjectIterator.h"   // For finding the subsystem instance
 #include "Engine/GameInstance.h"       // For GetGameInstance()
+#include "GameFramework/Actor.h"       // For scoped repositories
+#include "Algo/BinarySearch.h"         // For sorted insertion
+#include "UObject/UObjectGlobals.h"    // For FCoreUObjectDelegates
+#include "Templates/Invoke.h"          // For the typed column accessors
+
+namespace GameplayTagValueSubsystem
+{
+    /** Priority of a registered repository, repositories whose object was destroyed sort last. */
+    static int32 GetPriority(const TScriptInterface<ITagValueRepository>& Repository)
+    {
+        return Repository.GetObject() && Repository.GetInterface() ? Repository->GetRepositoryPriority() : MIN_int32;
+    }
+}
 
 void UGameplayTagValueSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
     Super::Initialize(Collection);
 
     // Create and register the default internal repository
-    DefaultRepositoryInternal = MakeShared<FMemoryTagValueRepository>(DefaultInternalRepositoryName, DefaultInternalRepositoryPriority);
+    if (bUseColumnarDefaultRepository)
+    {
+        TSharedPtr<FColumnarTagValueRepository> ColumnarRepository = MakeShared<FColumnarTagValueRepository>(DefaultInternalRepositoryName, DefaultInternalRepositoryPriority);
+        ColumnarDefaultRepository = ColumnarRepository.Get();
+        DefaultRepositoryInternal = ColumnarRepository;
+    }
+    else
+    {
+        DefaultRepositoryInternal = MakeShared<FMemoryTagValueRepository>(DefaultInternalRepositoryName, DefaultInternalRepositoryPriority);
+    }
+    BindRepository(*DefaultRepositoryInternal);
+    HandleRepositoriesChanged();
+
+    FCoreUObjectDelegates::GetPostGarbageCollect().AddUObject(this, &UGameplayTagValueSubsystem::HandlePostGarbageCollect);
+
+    if (bUseFlattenedView)
+    {
+        FlattenedView = MakeShared<FMemoryTagValueRepository>(FName(TEXT("FlattenedView")), 0);
+        MarkFlattenedViewDirty(FGameplayTag());
+    }
+    if (bEnableConcurrentReads)
+    {
+        MarkReadSnapshotDirty(FGameplayTag());
+    }
     
     // Manually create a TScriptInterface for the non-UObject repository
     // This is a bit more involved as TScriptInterface is typically for UObjects.
@@ -26,8 +63,59 @@ void UGameplayTagValueSubsystem::Initialize(FSubsystemCollectionBase& Collection
 
 void UGameplayTagValueSubsystem::Deinitialize()
 {
+    FCoreUObjectDelegates::GetPostGarbageCollect().RemoveAll(this);
+
+    for (const TScriptInterface<ITagValueRepository>& Repo : Repositories)
+    {
+        if (Repo.GetObject() && Repo.GetInterface())
+        {
+            UnbindRepository(*Repo.GetInterface());
+        }
+    }
+    if (DefaultRepositoryInternal.IsValid())
+    {
+        UnbindRepository(*DefaultRepositoryInternal);
+    }
+
+    ColumnarDefaultRepository = nullptr;
     DefaultRepositoryInternal.Reset();
     Repositories.Empty();
+    RepositoryObjects.Empty();
+    ResolvedValueCache.Empty();
+    InheritedValueCache.Empty();
+    ValueFallbackChains.Empty();
+    ValueFallbackDependents.Empty();
+    if (FlattenedViewUpdateHandle.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(FlattenedViewUpdateHandle);
+        FlattenedViewUpdateHandle.Reset();
+    }
+    FlattenedView.Reset();
+    DirtyFlattenedTags.Empty();
+
+    if (TagValueFlushHandle.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(TagValueFlushHandle);
+        TagValueFlushHandle.Reset();
+    }
+    ExactTagValueChangedEvents.Empty();
+    ChildTagValueChangedEvents.Empty();
+    NotifiedTagValues.Empty();
+    PendingTagValueChanges.Empty();
+    ModifierStacks.Empty();
+    ModifierTags.Empty();
+
+    if (ReadSnapshotPublishHandle.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(ReadSnapshotPublishHandle);
+        ReadSnapshotPublishHandle.Reset();
+    }
+    {
+        FRWScopeLock Lock(ReadSnapshotLock, SLT_Write);
+        ReadSnapshot.Reset();
+    }
+    DirtySnapshotTags.Empty();
+    ScopedRepositories.Empty();
     UE_LOG(LogGameplayTagValue, Log, TEXT("GameplayTagValueSubsystem Deinitialized."));
     Super::Deinitialize();
 }
@@ -49,10 +137,15 @@ void UGameplayTagValueSubsystem::RegisterRepository(TScriptInterface<ITagValueRe
 {
     if (Repository.GetInterface() && Repository.GetObjectRef()) // Ensure it's a valid UObject implementing the interface
     {
-        if (!Repositories.Contains(Repository))
+        bool bAlreadyRegistered = false;
+        RepositoryObjects.Add(TObjectKey<UObject>(Repository.GetObject()), &bAlreadyRegistered);
+        if (!bAlreadyRegistered)
         {
-            Repositories.Add(Repository);
-            SortRepositories();
+            // Inserted after the repositories of equal or higher priority, the array stays sorted without a full sort
+            const int32 InsertIndex = Algo::UpperBoundBy(Repositories, Repository->GetRepositoryPriority(), &GameplayTagValueSubsystem::GetPriority, TGreater<>());
+            Repositories.Insert(Repository, InsertIndex);
+            BindRepository(*Repository.GetInterface());
+            HandleRepositoriesChanged();
             UE_LOG(LogGameplayTagValue, Log, TEXT("Repository '%s' (Priority: %d) registered."), *Repository->GetRepositoryName().ToString(), Repository->GetRepositoryPriority());
         }
         else
@@ -70,10 +163,12 @@ void UGameplayTagValueSubsystem::UnregisterRepository(TScriptInterface<ITagValue
 {
     if (Repository.GetInterface() && Repository.GetObjectRef())
     {
-        const int32 RemovedCount = Repositories.Remove(Repository);
-        if (RemovedCount > 0)
+        if (RepositoryObjects.Remove(TObjectKey<UObject>(Repository.GetObject())) > 0)
         {
-            SortRepositories(); // Re-sort if an element was actually removed
+            // Removing keeps the order, no need to sort again
+            Repositories.RemoveSingle(Repository);
+            UnbindRepository(*Repository.GetInterface());
+            HandleRepositoriesChanged();
             UE_LOG(LogGameplayTagValue, Log, TEXT("Repository '%s' unregistered."), *Repository->GetRepositoryName().ToString());
         }
         else
@@ -87,154 +182,1414 @@ void UGameplayTagValueSubsystem::UnregisterRepository(TScriptInterface<ITagValue
     }
 }
 
-bool UGameplayTagValueSubsystem::GetInstancedStructValue(FGameplayTag Tag, FInstancedStruct& OutValue) const
+void UGameplayTagValueSubsystem::RegisterRepositories(TConstArrayView<TScriptInterface<ITagValueRepository>> NewRepositories)
 {
-    if (!Tag.IsValid()) return false;
+    QUICK_SCOPE_CYCLE_COUNTER(GameplayTagValue_RegisterRepositories);
 
-    // Check UObject repositories first (sorted by priority)
-    for (const TScriptInterface<ITagValueRepository>& Repo : Repositories)
+    const int32 NumRegistered = Repositories.Num();
+    Repositories.Reserve(NumRegistered + NewRepositories.Num());
+    RepositoryObjects.Reserve(NumRegistered + NewRepositories.Num());
+    for (const TScriptInterface<ITagValueRepository>& Repository : NewRepositories)
     {
-        if (Repo && Repo->HasValue(Tag))
+        bool bAlreadyRegistered = true;
+        if (Repository.GetInterface() && Repository.GetObject())
+        {
+            RepositoryObjects.Add(TObjectKey<UObject>(Repository.GetObject()), &bAlreadyRegistered);
+        }
+        if (!bAlreadyRegistered)
         {
-            return Repo->GetValue(Tag, OutValue);
+            Repositories.Add(Repository);
+            BindRepository(*Repository.GetInterface());
         }
     }
 
-    // Check default internal repository if not found in others
-    if (DefaultRepositoryInternal.IsValid() && DefaultRepositoryInternal->HasValue(Tag))
+    const int32 NumAdded = Repositories.Num() - NumRegistered;
+    if (NumAdded > 0)
     {
-        return DefaultRepositoryInternal->GetValue(Tag, OutValue);
+        // One stable sort for the whole batch, equal priorities keep their registration order
+        SortRepositories();
+        HandleRepositoriesChanged();
     }
-    
-    UE_LOG(LogGameplayTagValue, Warning, TEXT("GetTagValue_Instanced: Tag %s not found in any repository."), *Tag.ToString());
-    return false;
+    UE_LOG(LogGameplayTagValue, Log, TEXT("%d of %d repositories registered."), NumAdded, NewRepositories.Num());
 }
 
-void UGameplayTagValueSubsystem::SetInstancedStructValue(FGameplayTag Tag, const FInstancedStruct& InValue, FName TargetRepositoryName)
+void UGameplayTagValueSubsystem::UnregisterRepositories(TConstArrayView<TScriptInterface<ITagValueRepository>> OldRepositories)
 {
-    if (!Tag.IsValid())
+    QUICK_SCOPE_CYCLE_COUNTER(GameplayTagValue_UnregisterRepositories);
+
+    TSet<const UObject*> RemovedObjects;
+    RemovedObjects.Reserve(OldRepositories.Num());
+    for (const TScriptInterface<ITagValueRepository>& Repository : OldRepositories)
     {
-        UE_LOG(LogGameplayTagValue, Warning, TEXT("SetTagValue_Instanced: Tag %s. Value struct is invalid."), *Tag.ToString());
+        if (Repository.GetInterface() && RepositoryObjects.Remove(TObjectKey<UObject>(Repository.GetObject())) > 0)
+        {
+            RemovedObjects.Add(Repository.GetObject());
+            UnbindRepository(*Repository.GetInterface());
+        }
+    }
+
+    if (RemovedObjects.Num() > 0)
+    {
+        // A single pass over the registered repositories, the remaining ones keep their order
+        Repositories.RemoveAll([&RemovedObjects](const TScriptInterface<ITagValueRepository>& Repository)
+        {
+            return RemovedObjects.Contains(Repository.GetObject());
+        });
+        HandleRepositoriesChanged();
+    }
+    UE_LOG(LogGameplayTagValue, Log, TEXT("%d of %d repositories unregistered."), RemovedObjects.Num(), OldRepositories.Num());
+}
+
+void UGameplayTagValueSubsystem::HandlePostGarbageCollect()
+{
+    // Repositories destroyed without unregistering were nulled by the collector, their bindings went away with them
+    const int32 NumRemoved = Repositories.RemoveAll([](const TScriptInterface<ITagValueRepository>& Repository)
+    {
+        return !IsValid(Repository.GetObject()) || !Repository.GetInterface();
+    });
+    for (auto It = RepositoryObjects.CreateIterator(); It; ++It)
+    {
+        if (!It->ResolveObjectPtr())
+        {
+            It.RemoveCurrent();
+        }
+    }
+
+    if (NumRemoved > 0)
+    {
+        UE_LOG(LogGameplayTagValue, Verbose, TEXT("%d garbage collected repositories dropped."), NumRemoved);
+        HandleRepositoriesChanged();
+    }
+
+    // Sources destroyed without removing their modifiers would otherwise keep them applied forever, out of reach of RemoveValueModifiersFromSource
+    const int32 NumModifiersRemoved = RemoveValueModifiersIf([](const FTagValueModifier& Modifier)
+    {
+        return Modifier.Source.IsStale();
+    });
+    UE_CLOG(NumModifiersRemoved > 0, LogGameplayTagValue, Verbose, TEXT("%d modifiers of garbage collected sources dropped."), NumModifiersRemoved);
+}
+
+void UGameplayTagValueSubsystem::RegisterScopedRepository(AActor* ScopeActor, TScriptInterface<ITagValueRepository> Repository)
+{
+    if (!ScopeActor || !Repository.GetInterface() || !Repository.GetObjectRef())
+    {
+        UE_LOG(LogGameplayTagValue, Warning, TEXT("Attempted to register a null scoped repository interface or a repository without scope actor."));
         return;
     }
-    
-    ITagValueRepository* WritableRepo = GetWritableRepository(TargetRepositoryName);
-    if (WritableRepo)
+
+    TArray<TScriptInterface<ITagValueRepository>>& ScopedList = ScopedRepositories.FindOrAdd(ScopeActor).Repositories;
+    if (ScopedList.Contains(Repository))
     {
-        WritableRepo->SetValue(Tag, InValue);
-        UE_LOG(LogGameplayTagValue, Verbose, TEXT("Registering repository: %s with priority %d"), *WritableRepo->GetRepositoryName().ToString(), WritableRepo->GetRepositoryPriority());
+        UE_LOG(LogGameplayTagValue, Warning, TEXT("Attempted to register scoped repository %s which is already registered."), *Repository->GetRepositoryName().ToString());
+        return;
     }
-    else
+
+    // Actors rarely carry more than a couple of repositories, insert after the ones of equal or higher priority
+    const int32 Priority = Repository->GetRepositoryPriority();
+    const int32 InsertIndex = Algo::UpperBoundBy(ScopedList, Priority, &GameplayTagValueSubsystem::GetPriority, TGreater<>());
+    ScopedList.Insert(Repository, InsertIndex);
+    UE_LOG(LogGameplayTagValue, Verbose, TEXT("Repository '%s' (Priority: %d) registered for actor %s."), *Repository->GetRepositoryName().ToString(), Priority, *ScopeActor->GetName());
+}
+
+void UGameplayTagValueSubsystem::UnregisterScopedRepository(AActor* ScopeActor, TScriptInterface<ITagValueRepository> Repository)
+{
+    FTagValueRepositoryList* ScopedList = ScopedRepositories.Find(ScopeActor);
+    if (!ScopedList || ScopedList->Repositories.Remove(Repository) == 0)
     {
-        UE_LOG(LogGameplayTagValue, Warning, TEXT("SetTagValue_Instanced: No repositories available to set value for tag %s."), *Tag.ToString());
+        UE_LOG(LogGameplayTagValue, Warning, TEXT("Scoped repository not found for unregistration."));
+        return;
+    }
+
+    if (ScopedList->Repositories.IsEmpty())
+    {
+        ScopedRepositories.Remove(ScopeActor);
     }
 }
 
-void UGameplayTagValueSubsystem::GetTagValue_Instanced(FGameplayTag Tag, FInstancedStruct& Value, bool& bSuccess) const
+void UGameplayTagValueSubsystem::NotifyRepositoryPriorityChanged(TScriptInterface<ITagValueRepository> Repository)
 {
-    bSuccess = GetInstancedStructValue(Tag, Value);
+    if (!Repository.GetInterface() || !Repository.GetObject())
+    {
+        return;
+    }
+
+    if (RepositoryObjects.Contains(TObjectKey<UObject>(Repository.GetObject())))
+    {
+        // The order decides which repository wins, every cached resolution may be wrong now
+        SortRepositories();
+        HandleRepositoriesChanged();
+        return;
+    }
+
+    // Scoped lists are short and never cached, sorting the one holding the repository is enough
+    for (TPair<TObjectPtr<AActor>, FTagValueRepositoryList>& Pair : ScopedRepositories)
+    {
+        if (Pair.Value.Repositories.Contains(Repository))
+        {
+            Pair.Value.Repositories.StableSort([](const TScriptInterface<ITagValueRepository>& A, const TScriptInterface<ITagValueRepository>& B)
+            {
+                return GameplayTagValueSubsystem::GetPriority(A) > GameplayTagValueSubsystem::GetPriority(B);
+            });
+            return;
+        }
+    }
 }
 
-void UGameplayTagValueSubsystem::SetTagValue_Instanced(FGameplayTag Tag, const FInstancedStruct& Value, FName TargetRepositoryName)
+const AActor* UGameplayTagValueSubsystem::GetScopeActor(const UObject* Context)
 {
-    SetInstancedStructValue(Tag, Value, TargetRepositoryName);
+    if (!Context)
+    {
+        return nullptr;
+    }
+    if (const AActor* Actor = Cast<AActor>(Context))
+    {
+        return Actor;
+    }
+    return Context->GetTypedOuter<AActor>();
 }
 
-bool UGameplayTagValueSubsystem::HasTagValue(FGameplayTag Tag) const
+template<typename VisitorType>
+bool UGameplayTagValueSubsystem::VisitRepositories(const AActor* ScopeActor, VisitorType&& Visitor) const
 {
-    if (!Tag.IsValid()) return false;
+    static const TArray<TScriptInterface<ITagValueRepository>> NoScopedRepositories;
+    // The key is only compared, the actor is never modified through it
+    const FTagValueRepositoryList* ScopedList = ScopeActor ? ScopedRepositories.Find(const_cast<AActor*>(ScopeActor)) : nullptr;
+    const TArray<TScriptInterface<ITagValueRepository>>& Scoped = ScopedList ? ScopedList->Repositories : NoScopedRepositories;
 
-    for (const TScriptInterface<ITagValueRepository>& Repo : Repositories)
+    // Both lists are sorted by priority, merge them on the fly
+    int32 ScopedIndex = 0;
+    int32 GlobalIndex = 0;
+    while (ScopedIndex < Scoped.Num() || GlobalIndex < Repositories.Num())
     {
-        if (Repo && Repo->HasValue(Tag))
+        const bool bTakeScoped = GlobalIndex >= Repositories.Num()
+            || (ScopedIndex < Scoped.Num() && GameplayTagValueSubsystem::GetPriority(Scoped[ScopedIndex]) >= GameplayTagValueSubsystem::GetPriority(Repositories[GlobalIndex]));
+        const TScriptInterface<ITagValueRepository>& Repo = bTakeScoped ? Scoped[ScopedIndex++] : Repositories[GlobalIndex++];
+        if (Repo.GetObject() && Repo.GetInterface() && Visitor(*Repo.GetInterface()))
         {
             return true;
         }
     }
-    if (DefaultRepositoryInternal.IsValid() && DefaultRepositoryInternal->HasValue(Tag))
+
+    // The default internal repository is always checked last
+    return DefaultRepositoryInternal.IsValid() && Visitor(*DefaultRepositoryInternal);
+}
+
+bool UGameplayTagValueSubsystem::GetInstancedStructValue(FGameplayTag Tag, FInstancedStruct& OutValue, const UObject* Context) const
+{
+    if (!Tag.IsValid()) return false;
+
+    if (const FInstancedStruct* Value = ResolveValue(Tag, GetScopeActor(Context)))
     {
+        OutValue = *Value;
         return true;
     }
+
+    UE_LOG(LogGameplayTagValue, Warning, TEXT("GetTagValue_Instanced: Tag %s not found in any repository."), *Tag.ToString());
     return false;
 }
 
-void UGameplayTagValueSubsystem::ClearTagValue(FGameplayTag Tag, FName TargetRepositoryName)
+int32 UGameplayTagValueSubsystem::GetValues(TConstArrayView<FGameplayTag> Tags, TArrayView<FInstancedStruct> OutValues, TArrayView<bool> OutFound, const UObject* Context) const
 {
-    if (!Tag.IsValid()) return;
+    QUICK_SCOPE_CYCLE_COUNTER(GameplayTagValue_GetValues);
+    check(OutValues.Num() == Tags.Num() && OutFound.Num() == Tags.Num());
 
-    ITagValueRepository* WritableRepo = GetWritableRepository(TargetRepositoryName);
-    if (WritableRepo)
+    int32 NumRemaining = 0;
+    for (int32 Index = 0; Index < Tags.Num(); ++Index)
     {
-        WritableRepo->ClearValue(Tag);
-        UE_LOG(LogGameplayTagValue, Verbose, TEXT("Tag '%s' cleared from repository '%s'."), *Tag.ToString(), *WritableRepo->GetRepositoryName().ToString());
+        OutFound[Index] = false;
+        NumRemaining += Tags[Index].IsValid() ? 1 : 0;
+    }
+
+    const AActor* ScopeActor = GetScopeActor(Context);
+    const bool bScoped = ScopeActor && ScopedRepositories.Contains(const_cast<AActor*>(ScopeActor));
+    if (bUseValueInheritance || (!bScoped && FlattenedView.IsValid()))
+    {
+        // Inherited and flattened values already resolve with a single lookup per tag
+        for (int32 Index = 0; Index < Tags.Num(); ++Index)
+        {
+            const FInstancedStruct* Value = Tags[Index].IsValid() ? ResolveValue(Tags[Index], ScopeActor) : nullptr;
+            if (Value)
+            {
+                OutValues[Index] = *Value;
+                OutFound[Index] = true;
+                --NumRemaining;
+            }
+        }
     }
     else
     {
-        UE_LOG(LogGameplayTagValue, Warning, TEXT("SetTagValue_Instanced: Could not find repository named %s to set value for tag %s."), *TargetRepositoryName.ToString(), *Tag.ToString());
+        // Each repository is asked for every tag still missing, and the walk stops once every tag is found
+        VisitRepositories(ScopeActor, [&Tags, &OutValues, &OutFound, &NumRemaining](ITagValueRepository& Repo)
+        {
+            for (int32 Index = 0; Index < Tags.Num(); ++Index)
+            {
+                if (OutFound[Index] || !Tags[Index].IsValid())
+                {
+                    continue;
+                }
+                if (const FInstancedStruct* Value = Repo.FindValue(Tags[Index]))
+                {
+                    OutValues[Index] = *Value;
+                    OutFound[Index] = true;
+                    --NumRemaining;
+                }
+            }
+            return NumRemaining == 0;
+        });
+    }
+
+    int32 NumFound = 0;
+    for (int32 Index = 0; Index < Tags.Num(); ++Index)
+    {
+        if (OutFound[Index])
+        {
+            ++NumFound;
+        }
+        else
+        {
+            OutValues[Index].Reset();
+        }
     }
+    return NumFound;
 }
 
-void UGameplayTagValueSubsystem::ClearAllTagValues(FName TargetRepositoryName)
+void UGameplayTagValueSubsystem::SetValues(TConstArrayView<FGameplayTag> Tags, TConstArrayView<FInstancedStruct> InValues, FName TargetRepositoryName, const UObject* Context)
 {
-    ITagValueRepository* WritableRepo = GetWritableRepository(TargetRepositoryName);
-    if (WritableRepo)
+    check(Tags.Num() == InValues.Num());
+    if (Tags.IsEmpty())
     {
-        WritableRepo->ClearAllValues();
-        UE_LOG(LogGameplayTagValue, Verbose, TEXT("All values cleared from repository '%s'."), *WritableRepo->GetRepositoryName().ToString());
+        return;
+    }
+
+    if (ITagValueRepository* WritableRepo = GetWritableRepository(TargetRepositoryName, GetScopeActor(Context)))
+    {
+        WritableRepo->SetValues(Tags, InValues);
+    }
+    else
+    {
+        UE_LOG(LogGameplayTagValue, Warning, TEXT("SetValues: No repositories available to set %d values."), Tags.Num());
     }
 }
 
-void UGameplayTagValueSubsystem::SortRepositories()
+FTagValueView UGameplayTagValueSubsystem::GetValueView(FGameplayTag Tag, const UObject* Context) const
 {
-    Repositories.Sort([](const TScriptInterface<ITagValueRepository>& A, const TScriptInterface<ITagValueRepository>& B) {
-        if (!A.GetInterface() || !B.GetInterface()) // Should not happen if registration is done correctly
-        {
-            return !A.GetInterface(); // Nulls go to the end
-        }
-        return A->GetRepositoryPriority() > B->GetRepositoryPriority(); // Sort descending by priority
-    });
+    const ITagValueRepository* Repository = nullptr;
+    if (const FInstancedStruct* Value = Tag.IsValid() ? ResolveValue(Tag, GetScopeActor(Context), &Repository) : nullptr)
+    {
+        return FTagValueView(*Repository, *Value);
+    }
+    return FTagValueView();
 }
 
-ITagValueRepository* UGameplayTagValueSubsystem::GetWritableRepository(FName RepositoryName) const
+const FInstancedStruct* UGameplayTagValueSubsystem::ResolveValue(FGameplayTag Tag, const AActor* ScopeActor, const ITagValueRepository** OutRepository) const
 {
-    if (RepositoryName != NAME_None)
+    if (!bUseValueInheritance)
+    {
+        return ResolveDirectValue(Tag, ScopeActor, OutRepository);
+    }
+
+    // Scopes with repositories of their own walk the chain without caching
+    if (ScopeActor && ScopedRepositories.Contains(const_cast<AActor*>(ScopeActor)))
     {
-        // Find specific UObject repository
-        for (const TScriptInterface<ITagValueRepository>& Repo : Repositories)
+        for (const FGameplayTag& ChainTag : GetValueFallbackChain(Tag))
         {
-            if (Repo && Repo->GetRepositoryName() == RepositoryName)
+            if (const FInstancedStruct* Value = ResolveDirectValue(ChainTag, ScopeActor, OutRepository))
             {
-                return Repo.GetInterface();
+                return Value;
             }
         }
-        // Check if it's the default internal repository
-        if (DefaultRepositoryInternal.IsValid() && DefaultRepositoryInternal->GetRepositoryName() == RepositoryName)
+        return nullptr;
+    }
+
+    if (const FResolvedTagValue* Cached = InheritedValueCache.Find(Tag))
+    {
+        if (!Cached->Repository || Cached->Repository->GetRepositoryVersion() == Cached->RepositoryVersion)
         {
-            return DefaultRepositoryInternal.Get();
+            if (OutRepository)
+            {
+                *OutRepository = Cached->Repository;
+            }
+            return Cached->Value;
         }
     }
-    else // If NAME_None, find the highest priority writable one
+
+    FResolvedTagValue Resolved;
+    for (const FGameplayTag& ChainTag : GetValueFallbackChain(Tag))
     {
-        // Check UObject repositories first
-        if (Repositories.Num() > 0 && Repositories[0].GetInterface())
+        const ITagValueRepository* Repository = nullptr;
+        if (const FInstancedStruct* Value = ResolveDirectValue(ChainTag, nullptr, &Repository))
         {
-             // Assuming sorted, the first one is highest priority among UObject repos
-            return Repositories[0].GetInterface();
+            // The cache entry shares its type with direct lookups, the repository is never modified through it
+            Resolved.Repository = const_cast<ITagValueRepository*>(Repository);
+            Resolved.RepositoryVersion = Repository->GetRepositoryVersion();
+            Resolved.Value = Value;
+            break;
         }
-        // Fallback to default internal repository if no UObject repositories or highest priority one is not valid
-        if (DefaultRepositoryInternal.IsValid())
+    }
+    InheritedValueCache.Add(Tag, Resolved);
+
+    if (OutRepository)
+    {
+        *OutRepository = Resolved.Repository;
+    }
+    return Resolved.Value;
+}
+
+template<typename ValueType, typename T, typename ColumnGetterType>
+bool UGameplayTagValueSubsystem::GetScalarValue(FGameplayTag Tag, T& OutValue, const UObject* Context, ColumnGetterType ColumnGetter) const
+{
+    if (!Tag.IsValid())
+    {
+        return false;
+    }
+
+    const AActor* ScopeActor = GetScopeActor(Context);
+    const FInstancedStruct* Value = nullptr;
+
+    // Direct global reads go through the resolved value cache, and to the typed column when the columnar repository wins.
+    // Inherited, scoped and flattened reads resolve their FInstancedStruct as usual.
+    const bool bScoped = ScopeActor && ScopedRepositories.Contains(const_cast<AActor*>(ScopeActor));
+    if (ColumnarDefaultRepository && !bUseValueInheritance && !bScoped && !FlattenedView.IsValid())
+    {
+        const FResolvedTagValue* Cached = ResolvedValueCache.Find(Tag);
+        if (!Cached || (Cached->Repository && Cached->Repository->GetRepositoryVersion() != Cached->RepositoryVersion))
         {
-            // This logic needs refinement: if there are UObject repos, we should compare their priority
-            // with DefaultRepositoryInternal's priority. For now, it prioritizes any registered UObject repo.
-            // A better approach would be to include the DefaultRepositoryInternal in the sorting logic
-            // perhaps via a wrapper or by having a combined list for GetValue operations.
-            // For SetValue with NAME_None, we need a clear rule. Let's assume for now it targets the
-            // highest priority registered UObject repo, or the default internal if none are registered.
-            if (Repositories.Num() == 0)
+            // Resolve the winner without asking the columnar repository to box its value
+            FResolvedTagValue Resolved;
+            VisitRepositories(nullptr, [this, &Tag, &Resolved](ITagValueRepository& Repo)
+            {
+                if (&Repo == ColumnarDefaultRepository)
+                {
+                    Resolved.Repository = Repo.HasValue(Tag) ? &Repo : nullptr;
+                }
+                else if ((Resolved.Value = Repo.FindValue(Tag)) != nullptr)
+                {
+                    Resolved.Repository = &Repo;
+                }
+                return Resolved.Repository != nullptr;
+            });
+            if (Resolved.Repository)
             {
-                 return DefaultRepositoryInternal.Get();
+                Resolved.RepositoryVersion = Resolved.Repository->GetRepositoryVersion();
             }
+            Cached = &ResolvedValueCache.Add(Tag, Resolved);
+        }
+
+        if (Cached->Repository == ColumnarDefaultRepository)
+        {
+            return Invoke(ColumnGetter, *ColumnarDefaultRepository, Tag, OutValue);
         }
+        Value = Cached->Value;
     }
-    return nullptr;
+    else
+    {
+        Value = ResolveValue(Tag, ScopeActor);
+    }
+
+    // Same exact type rule as the columns, derived structs are not scalars
+    if (Value && Value->GetScriptStruct() == ValueType::StaticStruct())
+    {
+        OutValue = Value->Get<ValueType>().Value;
+        return true;
+    }
+    return false;
+}
+
+template<typename ValueType, typename T, typename ColumnSetterType>
+void UGameplayTagValueSubsystem::SetScalarValue(FGameplayTag Tag, const T& InValue, FName TargetRepositoryName, const UObject* Context, ColumnSetterType ColumnSetter)
+{
+    if (!Tag.IsValid())
+    {
+        return;
+    }
+
+    ITagValueRepository* WritableRepo = GetWritableRepository(TargetRepositoryName, GetScopeActor(Context));
+    if (WritableRepo && WritableRepo == ColumnarDefaultRepository)
+    {
+        Invoke(ColumnSetter, *ColumnarDefaultRepository, Tag, InValue);
+    }
+    else if (WritableRepo)
+    {
+        ValueType Value;
+        Value.Value = InValue;
+        WritableRepo->SetValue(Tag, FInstancedStruct::Make(Value));
+    }
+    else
+    {
+        UE_LOG(LogGameplayTagValue, Warning, TEXT("SetTagValue: No repositories available to set value for tag %s."), *Tag.ToString());
+    }
+}
+
+bool UGameplayTagValueSubsystem::GetFloatValue(FGameplayTag Tag, float& OutValue, const UObject* Context) const
+{
+    return GetScalarValue<FTagValueFloat>(Tag, OutValue, Context, &FColumnarTagValueRepository::GetFloat);
+}
+
+bool UGameplayTagValueSubsystem::GetIntValue(FGameplayTag Tag, int32& OutValue, const UObject* Context) const
+{
+    return GetScalarValue<FTagValueInt>(Tag, OutValue, Context, &FColumnarTagValueRepository::GetInt);
+}
+
+bool UGameplayTagValueSubsystem::GetBoolValue(FGameplayTag Tag, bool& OutValue, const UObject* Context) const
+{
+    return GetScalarValue<FTagValueBool>(Tag, OutValue, Context, &FColumnarTagValueRepository::GetBool);
+}
+
+bool UGameplayTagValueSubsystem::GetVectorValue(FGameplayTag Tag, FVector& OutValue, const UObject* Context) const
+{
+    return GetScalarValue<FTagValueVector>(Tag, OutValue, Context, &FColumnarTagValueRepository::GetVector);
+}
+
+void UGameplayTagValueSubsystem::SetFloatValue(FGameplayTag Tag, float InValue, FName TargetRepositoryName, const UObject* Context)
+{
+    SetScalarValue<FTagValueFloat>(Tag, InValue, TargetRepositoryName, Context, &FColumnarTagValueRepository::SetFloat);
+}
+
+void UGameplayTagValueSubsystem::SetIntValue(FGameplayTag Tag, int32 InValue, FName TargetRepositoryName, const UObject* Context)
+{
+    SetScalarValue<FTagValueInt>(Tag, InValue, TargetRepositoryName, Context, &FColumnarTagValueRepository::SetInt);
+}
+
+void UGameplayTagValueSubsystem::SetBoolValue(FGameplayTag Tag, bool InValue, FName TargetRepositoryName, const UObject* Context)
+{
+    SetScalarValue<FTagValueBool>(Tag, InValue, TargetRepositoryName, Context, &FColumnarTagValueRepository::SetBool);
+}
+
+void UGameplayTagValueSubsystem::SetVectorValue(FGameplayTag Tag, const FVector& InValue, FName TargetRepositoryName, const UObject* Context)
+{
+    SetScalarValue<FTagValueVector>(Tag, InValue, TargetRepositoryName, Context, &FColumnarTagValueRepository::SetVector);
+}
+
+const TArray<FGameplayTag>& UGameplayTagValueSubsystem::GetValueFallbackChain(FGameplayTag Tag) const
+{
+    if (const TArray<FGameplayTag>* Chain = ValueFallbackChains.Find(Tag))
+    {
+        return *Chain;
+    }
+
+    TArray<FGameplayTag> Chain;
+    Chain.Add(Tag);
+
+    // Weapon.Rifle.Damage -> Weapon.Damage -> Damage, skipping the tags that are not registered
+    const FString TagName = Tag.GetTagName().ToString();
+    int32 LeafStart = INDEX_NONE;
+    if (TagName.FindLastChar(TEXT('.'), LeafStart))
+    {
+        const FString Leaf = TagName.RightChop(LeafStart + 1);
+        for (FGameplayTag Category = Tag.RequestDirectParent().RequestDirectParent();; Category = Category.RequestDirectParent())
+        {
+            const FString FallbackName = Category.IsValid() ? FString::Printf(TEXT("%s.%s"), *Category.ToString(), *Leaf) : Leaf;
+            const FGameplayTag Fallback = FGameplayTag::RequestGameplayTag(FName(*FallbackName), false);
+            if (Fallback.IsValid())
+            {
+                Chain.Add(Fallback);
+            }
+            if (!Category.IsValid())
+            {
+                break;
+            }
+        }
+    }
+
+    for (const FGameplayTag& ChainTag : Chain)
+    {
+        ValueFallbackDependents.FindOrAdd(ChainTag).Add(Tag);
+    }
+    return ValueFallbackChains.Add(Tag, MoveTemp(Chain));
+}
+
+void UGameplayTagValueSubsystem::InvalidateInheritedValues(FGameplayTag Tag)
+{
+    if (!Tag.IsValid())
+    {
+        InheritedValueCache.Reset();
+        MarkModifiedValueDirty(FGameplayTag());
+        return;
+    }
+
+    if (const TArray<FGameplayTag>* Dependents = ValueFallbackDependents.Find(Tag))
+    {
+        for (const FGameplayTag& Dependent : *Dependents)
+        {
+            InheritedValueCache.Remove(Dependent);
+
+            // The inherited value of the dependent may have changed along with the tag
+            if (Dependent != Tag && bUseValueInheritance)
+            {
+                MarkModifiedValueDirty(Dependent);
+                QueueTagValueChanged(Dependent);
+            }
+        }
+    }
+}
+
+const FInstancedStruct* UGameplayTagValueSubsystem::ResolveDirectValue(FGameplayTag Tag, const AActor* ScopeActor, const ITagValueRepository** OutRepository) const
+{
+    // Scopes with repositories of their own walk them along with the global ones
+    // The key is only compared, the actor is never modified through it
+    if (ScopeActor && ScopedRepositories.Contains(const_cast<AActor*>(ScopeActor)))
+    {
+        const FInstancedStruct* Result = nullptr;
+        VisitRepositories(ScopeActor, [&Tag, &Result, OutRepository](ITagValueRepository& Repo)
+        {
+            Result = Repo.FindValue(Tag);
+            if (Result && OutRepository)
+            {
+                *OutRepository = &Repo;
+            }
+            return Result != nullptr;
+        });
+        return Result;
+    }
+
+    // Other scopes resolve exactly like global queries.
+    // Tags changed since the last update of the flattened view resolve through the cache below until the view is updated.
+    if (FlattenedView.IsValid() && !bFlattenedViewFullyDirty && !DirtyFlattenedTags.Contains(Tag))
+    {
+        const FInstancedStruct* Result = FlattenedView->FindValue(Tag);
+        if (Result && OutRepository)
+        {
+            *OutRepository = FlattenedView.Get();
+        }
+        return Result;
+    }
+
+    if (const FResolvedTagValue* Cached = ResolvedValueCache.Find(Tag))
+    {
+        // Entries resolved by the scalar accessors may know the winner without its value
+        if (!Cached->Repository || (Cached->Value && Cached->Repository->GetRepositoryVersion() == Cached->RepositoryVersion))
+        {
+            if (OutRepository)
+            {
+                *OutRepository = Cached->Repository;
+            }
+            return Cached->Value;
+        }
+    }
+
+    FResolvedTagValue Resolved;
+    Resolved.Value = ResolveGlobalValueUncached(Tag, &Resolved.Repository);
+    if (Resolved.Repository)
+    {
+        Resolved.RepositoryVersion = Resolved.Repository->GetRepositoryVersion();
+    }
+    ResolvedValueCache.Add(Tag, Resolved);
+
+    if (OutRepository)
+    {
+        *OutRepository = Resolved.Repository;
+    }
+    return Resolved.Value;
+}
+
+const FInstancedStruct* UGameplayTagValueSubsystem::ResolveGlobalValueUncached(FGameplayTag Tag, ITagValueRepository** OutRepository) const
+{
+    const FInstancedStruct* Result = nullptr;
+    VisitRepositories(nullptr, [&Tag, &Result, OutRepository](ITagValueRepository& Repo)
+    {
+        Result = Repo.FindValue(Tag);
+        if (Result && OutRepository)
+        {
+            *OutRepository = &Repo;
+        }
+        return Result != nullptr;
+    });
+    return Result;
+}
+
+void UGameplayTagValueSubsystem::SetUseFlattenedView(bool bEnabled)
+{
+    bUseFlattenedView = bEnabled;
+    if (!bEnabled)
+    {
+        FlattenedView.Reset();
+    }
+    else if (!FlattenedView.IsValid())
+    {
+        FlattenedView = MakeShared<FMemoryTagValueRepository>(FName(TEXT("FlattenedView")), 0);
+        MarkFlattenedViewDirty(FGameplayTag());
+    }
+
+    // Inherited values may point into the previous view
+    InheritedValueCache.Reset();
+}
+
+void UGameplayTagValueSubsystem::SetUseValueInheritance(bool bEnabled)
+{
+    if (bUseValueInheritance != bEnabled)
+    {
+        bUseValueInheritance = bEnabled;
+        InheritedValueCache.Reset();
+        MarkModifiedValueDirty(FGameplayTag());
+        QueueTagValueChanged(FGameplayTag());
+    }
+}
+
+void UGameplayTagValueSubsystem::FlushFlattenedView()
+{
+    if (FlattenedView.IsValid())
+    {
+        UpdateFlattenedView();
+    }
+}
+
+void UGameplayTagValueSubsystem::UpdateFlattenedView()
+{
+    if (bFlattenedViewFullyDirty)
+    {
+        QUICK_SCOPE_CYCLE_COUNTER(GameplayTagValue_RebuildFlattenedView);
+
+        FlattenedView->ClearAllValues();
+
+        // Repositories are visited by priority, the first value found for a tag wins
+        TArray<FGameplayTag> RepositoryTags;
+        VisitRepositories(nullptr, [this, &RepositoryTags](ITagValueRepository& Repo)
+        {
+            RepositoryTags.Reset();
+            Repo.GetAllTags(RepositoryTags);
+            for (const FGameplayTag& Tag : RepositoryTags)
+            {
+                if (!FlattenedView->HasValue(Tag))
+                {
+                    FlattenedView->SetValue(Tag, *Repo.FindValue(Tag));
+                }
+            }
+            return false;
+        });
+
+        bFlattenedViewFullyDirty = false;
+        DirtyFlattenedTags.Reset();
+        return;
+    }
+
+    if (DirtyFlattenedTags.Num() > 0)
+    {
+        for (const FGameplayTag& Tag : DirtyFlattenedTags)
+        {
+            if (const FInstancedStruct* Value = ResolveGlobalValueUncached(Tag))
+            {
+                FlattenedView->SetValue(Tag, *Value);
+            }
+            else
+            {
+                FlattenedView->ClearValue(Tag);
+            }
+        }
+        DirtyFlattenedTags.Reset();
+    }
+}
+
+void UGameplayTagValueSubsystem::MarkFlattenedViewDirty(FGameplayTag Tag)
+{
+    if (!FlattenedView.IsValid())
+    {
+        return;
+    }
+
+    if (!Tag.IsValid())
+    {
+        bFlattenedViewFullyDirty = true;
+        DirtyFlattenedTags.Reset();
+    }
+    else if (!bFlattenedViewFullyDirty)
+    {
+        DirtyFlattenedTags.Add(Tag);
+    }
+
+    if (!FlattenedViewUpdateHandle.IsValid())
+    {
+        FlattenedViewUpdateHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &UGameplayTagValueSubsystem::HandleUpdateFlattenedView));
+    }
+}
+
+bool UGameplayTagValueSubsystem::HandleUpdateFlattenedView(float DeltaTime)
+{
+    FlattenedViewUpdateHandle.Reset();
+    FlushFlattenedView();
+    return false;
+}
+
+void UGameplayTagValueSubsystem::BindRepository(ITagValueRepository& Repository)
+{
+    Repository.OnRepositoryChanged().AddUObject(this, &UGameplayTagValueSubsystem::HandleRepositoryChanged);
+}
+
+void UGameplayTagValueSubsystem::UnbindRepository(ITagValueRepository& Repository)
+{
+    Repository.OnRepositoryChanged().RemoveAll(this);
+}
+
+void UGameplayTagValueSubsystem::HandleRepositoriesChanged()
+{
+    ResolvedValueCache.Reset();
+    InheritedValueCache.Reset();
+    MarkModifiedValueDirty(FGameplayTag());
+    MarkReadSnapshotDirty(FGameplayTag());
+    MarkFlattenedViewDirty(FGameplayTag());
+    QueueTagValueChanged(FGameplayTag());
+}
+
+void UGameplayTagValueSubsystem::HandleRepositoryChanged(ITagValueRepository& Repository, FGameplayTag Tag)
+{
+    // A repository may have gained a value that now wins over the cached one, or lost the cached one
+    if (Tag.IsValid())
+    {
+        ResolvedValueCache.Remove(Tag);
+    }
+    else
+    {
+        ResolvedValueCache.Reset();
+    }
+    MarkFlattenedViewDirty(Tag);
+
+    InvalidateInheritedValues(Tag);
+    MarkModifiedValueDirty(Tag);
+    MarkReadSnapshotDirty(Tag);
+    QueueTagValueChanged(Tag);
+}
+
+void UGameplayTagValueSubsystem::SetConcurrentReadsEnabled(bool bEnabled)
+{
+    check(IsInGameThread());
+
+    bEnableConcurrentReads = bEnabled;
+    if (bEnabled)
+    {
+        MarkReadSnapshotDirty(FGameplayTag());
+        PublishReadSnapshot();
+    }
+    else
+    {
+        FRWScopeLock Lock(ReadSnapshotLock, SLT_Write);
+        ReadSnapshot.Reset();
+    }
+}
+
+FTagValueSnapshotPtr UGameplayTagValueSubsystem::GetReadSnapshot() const
+{
+    FRWScopeLock Lock(ReadSnapshotLock, SLT_ReadOnly);
+    return ReadSnapshot;
+}
+
+bool UGameplayTagValueSubsystem::GetInstancedStructValueThreadSafe(FGameplayTag Tag, FInstancedStruct& OutValue) const
+{
+    const FTagValueSnapshotPtr Snapshot = GetReadSnapshot();
+    if (const FInstancedStruct* Value = Snapshot.IsValid() ? Snapshot->FindValue(Tag) : nullptr)
+    {
+        OutValue = *Value;
+        return true;
+    }
+    return false;
+}
+
+void UGameplayTagValueSubsystem::PublishReadSnapshot()
+{
+    check(IsInGameThread());
+    QUICK_SCOPE_CYCLE_COUNTER(GameplayTagValue_PublishReadSnapshot);
+
+    if (!bEnableConcurrentReads || (!bReadSnapshotFullyDirty && DirtySnapshotTags.IsEmpty()))
+    {
+        return;
+    }
+
+    // Only the game thread publishes, so the current snapshot can be read without the lock
+    TSharedRef<FTagValueSnapshot, ESPMode::ThreadSafe> NewSnapshot = MakeShared<FTagValueSnapshot, ESPMode::ThreadSafe>();
+    using FShard = FTagValueSnapshot::FShard;
+    if (bReadSnapshotFullyDirty || !ReadSnapshot.IsValid())
+    {
+        TArray<FGameplayTag> RepositoryTags;
+        VisitRepositories(nullptr, [&RepositoryTags](ITagValueRepository& Repo)
+        {
+            Repo.GetAllTags(RepositoryTags);
+            return false;
+        });
+
+        TSharedPtr<FShard, ESPMode::ThreadSafe> Shards[FTagValueSnapshot::NumShards];
+        for (const FGameplayTag& Tag : RepositoryTags)
+        {
+            TSharedPtr<FShard, ESPMode::ThreadSafe>& Shard = Shards[FTagValueSnapshot::GetShardIndex(Tag)];
+            if (!Shard.IsValid())
+            {
+                Shard = MakeShared<FShard, ESPMode::ThreadSafe>();
+            }
+            if (!Shard->Contains(Tag))
+            {
+                if (const FInstancedStruct* Value = ResolveDirectValue(Tag, nullptr))
+                {
+                    Shard->Add(Tag, MakeShared<FInstancedStruct, ESPMode::ThreadSafe>(*Value));
+                    ++NewSnapshot->NumValues;
+                }
+            }
+        }
+        for (int32 ShardIndex = 0; ShardIndex < FTagValueSnapshot::NumShards; ++ShardIndex)
+        {
+            NewSnapshot->Shards[ShardIndex] = Shards[ShardIndex];
+        }
+    }
+    else
+    {
+        // Readers may still hold the current snapshot, so it is copied rather than patched.
+        // Only the shards holding dirty tags are copied, the others and every unchanged value are shared with the current snapshot.
+        NewSnapshot->NumValues = ReadSnapshot->NumValues;
+        TSharedPtr<FShard, ESPMode::ThreadSafe> CopiedShards[FTagValueSnapshot::NumShards];
+        for (const FGameplayTag& Tag : DirtySnapshotTags)
+        {
+            const int32 ShardIndex = FTagValueSnapshot::GetShardIndex(Tag);
+            TSharedPtr<FShard, ESPMode::ThreadSafe>& Shard = CopiedShards[ShardIndex];
+            if (!Shard.IsValid())
+            {
+                const FTagValueSnapshot::FShardPtr& CurrentShard = ReadSnapshot->Shards[ShardIndex];
+                Shard = CurrentShard.IsValid() ? MakeShared<FShard, ESPMode::ThreadSafe>(*CurrentShard) : MakeShared<FShard, ESPMode::ThreadSafe>();
+            }
+
+            const int32 NumBefore = Shard->Num();
+            if (const FInstancedStruct* Value = ResolveDirectValue(Tag, nullptr))
+            {
+                Shard->Add(Tag, MakeShared<FInstancedStruct, ESPMode::ThreadSafe>(*Value));
+            }
+            else
+            {
+                Shard->Remove(Tag);
+            }
+            NewSnapshot->NumValues += Shard->Num() - NumBefore;
+        }
+        for (int32 ShardIndex = 0; ShardIndex < FTagValueSnapshot::NumShards; ++ShardIndex)
+        {
+            NewSnapshot->Shards[ShardIndex] = CopiedShards[ShardIndex].IsValid() ? FTagValueSnapshot::FShardPtr(CopiedShards[ShardIndex]) : ReadSnapshot->Shards[ShardIndex];
+        }
+    }
+
+    bReadSnapshotFullyDirty = false;
+    DirtySnapshotTags.Reset();
+
+    FRWScopeLock Lock(ReadSnapshotLock, SLT_Write);
+    ReadSnapshot = NewSnapshot;
+}
+
+void UGameplayTagValueSubsystem::MarkReadSnapshotDirty(FGameplayTag Tag)
+{
+    if (!bEnableConcurrentReads)
+    {
+        return;
+    }
+
+    if (!Tag.IsValid())
+    {
+        bReadSnapshotFullyDirty = true;
+        DirtySnapshotTags.Reset();
+    }
+    else if (!bReadSnapshotFullyDirty)
+    {
+        DirtySnapshotTags.Add(Tag);
+    }
+
+    if (!ReadSnapshotPublishHandle.IsValid())
+    {
+        ReadSnapshotPublishHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &UGameplayTagValueSubsystem::HandlePublishReadSnapshot));
+    }
+}
+
+bool UGameplayTagValueSubsystem::HandlePublishReadSnapshot(float DeltaTime)
+{
+    ReadSnapshotPublishHandle.Reset();
+    PublishReadSnapshot();
+    return false;
+}
+
+FTagValueModifierHandle UGameplayTagValueSubsystem::AddValueModifier(FGameplayTag Tag, ETagValueModifierOp Op, float Magnitude, int32 Priority, const UObject* Source)
+{
+    if (!Tag.IsValid())
+    {
+        return FTagValueModifierHandle();
+    }
+
+    FTagValueModifier Modifier;
+    Modifier.Handle.Id = NextModifierId++;
+    Modifier.Op = Op;
+    Modifier.Magnitude = Magnitude;
+    Modifier.Priority = Priority;
+    Modifier.Source = Source;
+
+    // Inserted after the modifiers of equal priority, so they apply in the order they were added
+    FTagValueModifierStack& Stack = ModifierStacks.FindOrAdd(Tag);
+    const int32 InsertIndex = Algo::UpperBoundBy(Stack.Modifiers, Priority, &FTagValueModifier::Priority);
+    Stack.Modifiers.Insert(Modifier, InsertIndex);
+    Stack.bDirty = true;
+
+    ModifierTags.Add(Modifier.Handle, Tag);
+    return Modifier.Handle;
+}
+
+bool UGameplayTagValueSubsystem::RemoveValueModifier(FTagValueModifierHandle Handle)
+{
+    FGameplayTag Tag;
+    if (!ModifierTags.RemoveAndCopyValue(Handle, Tag))
+    {
+        return false;
+    }
+
+    FTagValueModifierStack& Stack = ModifierStacks.FindChecked(Tag);
+    Stack.Modifiers.RemoveAll([&Handle](const FTagValueModifier& Modifier) { return Modifier.Handle == Handle; });
+    if (Stack.Modifiers.IsEmpty())
+    {
+        ModifierStacks.Remove(Tag);
+    }
+    else
+    {
+        Stack.bDirty = true;
+    }
+    return true;
+}
+
+int32 UGameplayTagValueSubsystem::RemoveValueModifiersFromSource(const UObject* Source)
+{
+    if (!Source)
+    {
+        return 0;
+    }
+
+    return RemoveValueModifiersIf([Source](const FTagValueModifier& Modifier)
+    {
+        return Modifier.Source.Get() == Source;
+    });
+}
+
+template<typename PredicateType>
+int32 UGameplayTagValueSubsystem::RemoveValueModifiersIf(PredicateType&& Predicate)
+{
+    int32 NumRemoved = 0;
+    for (auto StackIt = ModifierStacks.CreateIterator(); StackIt; ++StackIt)
+    {
+        FTagValueModifierStack& Stack = StackIt.Value();
+        const int32 NumModifiersRemoved = Stack.Modifiers.RemoveAll([this, &Predicate](const FTagValueModifier& Modifier)
+        {
+            if (Predicate(Modifier))
+            {
+                ModifierTags.Remove(Modifier.Handle);
+                return true;
+            }
+            return false;
+        });
+
+        if (NumModifiersRemoved > 0)
+        {
+            NumRemoved += NumModifiersRemoved;
+            Stack.bDirty = true;
+            if (Stack.Modifiers.IsEmpty())
+            {
+                StackIt.RemoveCurrent();
+            }
+        }
+    }
+    return NumRemoved;
+}
+
+float UGameplayTagValueSubsystem::GetModifiedValue(FGameplayTag Tag, float DefaultValue, const UObject* Context) const
+{
+    const AActor* ScopeActor = GetScopeActor(Context);
+    const FTagValueModifierStack* Stack = ModifierStacks.Find(Tag);
+    if (!Stack)
+    {
+        float BaseValue = DefaultValue;
+        GetNumericBaseValue(Tag, ScopeActor, BaseValue);
+        return BaseValue;
+    }
+
+    // The aggregate is cached for the unscoped base value only, scopes with repositories of their own recompute it
+    const bool bScoped = ScopeActor && ScopedRepositories.Contains(const_cast<AActor*>(ScopeActor));
+    if (!bScoped && !Stack->bDirty && Stack->bCachedHasBaseValue)
+    {
+        return Stack->CachedValue;
+    }
+
+    float Value = DefaultValue;
+    const bool bHasBaseValue = GetNumericBaseValue(Tag, ScopeActor, Value);
+    for (const FTagValueModifier& Modifier : Stack->Modifiers)
+    {
+        switch (Modifier.Op)
+        {
+        case ETagValueModifierOp::Add:
+            Value += Modifier.Magnitude;
+            break;
+        case ETagValueModifierOp::Multiply:
+            Value *= Modifier.Magnitude;
+            break;
+        case ETagValueModifierOp::Override:
+            Value = Modifier.Magnitude;
+            break;
+        }
+    }
+
+    // Without a base value the result depends on the default value of the caller, which is cheap enough to recompute
+    if (!bScoped)
+    {
+        Stack->CachedValue = Value;
+        Stack->bCachedHasBaseValue = bHasBaseValue;
+        Stack->bDirty = false;
+    }
+    return Value;
+}
+
+bool UGameplayTagValueSubsystem::GetNumericBaseValue(FGameplayTag Tag, const AActor* ScopeActor, float& OutValue) const
+{
+    if (const FInstancedStruct* Value = ResolveValue(Tag, ScopeActor))
+    {
+        if (const FTagValueFloat* FloatValue = Value->GetPtr<FTagValueFloat>())
+        {
+            OutValue = FloatValue->Value;
+            return true;
+        }
+        if (const FTagValueInt* IntValue = Value->GetPtr<FTagValueInt>())
+        {
+            OutValue = static_cast<float>(IntValue->Value);
+            return true;
+        }
+    }
+    return false;
+}
+
+void UGameplayTagValueSubsystem::MarkModifiedValueDirty(FGameplayTag Tag)
+{
+    if (!Tag.IsValid())
+    {
+        for (TPair<FGameplayTag, FTagValueModifierStack>& Pair : ModifierStacks)
+        {
+            Pair.Value.bDirty = true;
+        }
+    }
+    else if (FTagValueModifierStack* Stack = ModifierStacks.Find(Tag))
+    {
+        Stack->bDirty = true;
+    }
+}
+
+FOnTagValueChanged& UGameplayTagValueSubsystem::RegisterTagValueChangedEvent(FGameplayTag Tag, bool bIncludeChildren)
+{
+    // Record the values as they are now, so the first notification reports an actual change
+    if (bIncludeChildren)
+    {
+        TArray<FGameplayTag> RepositoryTags;
+        VisitRepositories(nullptr, [&RepositoryTags](ITagValueRepository& Repo)
+        {
+            Repo.GetAllTags(RepositoryTags);
+            return false;
+        });
+        for (const FGameplayTag& RepositoryTag : RepositoryTags)
+        {
+            if (RepositoryTag.MatchesTag(Tag))
+            {
+                SnapshotTagValue(RepositoryTag);
+            }
+        }
+        return ChildTagValueChangedEvents.FindOrAdd(Tag);
+    }
+
+    SnapshotTagValue(Tag);
+    return ExactTagValueChangedEvents.FindOrAdd(Tag);
+}
+
+void UGameplayTagValueSubsystem::UnregisterTagValueChangedEvent(FGameplayTag Tag, bool bIncludeChildren, FDelegateHandle Handle)
+{
+    TMap<FGameplayTag, FOnTagValueChanged>& Events = bIncludeChildren ? ChildTagValueChangedEvents : ExactTagValueChangedEvents;
+    if (FOnTagValueChanged* Event = Events.Find(Tag))
+    {
+        Event->Remove(Handle);
+        if (!Event->IsBound())
+        {
+            Events.Remove(Tag);
+            ForgetUnwatchedTagValues(Tag, bIncludeChildren);
+        }
+    }
+}
+
+void UGameplayTagValueSubsystem::BindTagValueChanged(FGameplayTag Tag, bool bIncludeChildren, FOnTagValueChangedDynamic Callback)
+{
+    if (UObject* Listener = Callback.GetUObject())
+    {
+        RegisterTagValueChangedEvent(Tag, bIncludeChildren).AddWeakLambda(Listener, [Callback](FGameplayTag ChangedTag, const FInstancedStruct& NewValue)
+        {
+            Callback.ExecuteIfBound(ChangedTag, NewValue);
+        });
+    }
+}
+
+void UGameplayTagValueSubsystem::UnbindTagValueChanged(FGameplayTag Tag, bool bIncludeChildren, UObject* Listener)
+{
+    TMap<FGameplayTag, FOnTagValueChanged>& Events = bIncludeChildren ? ChildTagValueChangedEvents : ExactTagValueChangedEvents;
+    if (FOnTagValueChanged* Event = Events.Find(Tag))
+    {
+        Event->RemoveAll(Listener);
+        if (!Event->IsBound())
+        {
+            Events.Remove(Tag);
+            ForgetUnwatchedTagValues(Tag, bIncludeChildren);
+        }
+    }
+}
+
+void UGameplayTagValueSubsystem::ForgetUnwatchedTagValues(FGameplayTag Tag, bool bIncludeChildren)
+{
+    // Changes of unwatched tags are not queued, so their last delivered value would be stale by the time they are watched again
+    for (auto It = NotifiedTagValues.CreateIterator(); It; ++It)
+    {
+        const bool bCovered = bIncludeChildren ? It.Key().MatchesTag(Tag) : It.Key() == Tag;
+        if (bCovered && !IsTagValueWatched(It.Key()))
+        {
+            It.RemoveCurrent();
+        }
+    }
+}
+
+bool UGameplayTagValueSubsystem::IsTagValueWatched(FGameplayTag Tag) const
+{
+    if (ExactTagValueChangedEvents.Contains(Tag))
+    {
+        return true;
+    }
+    if (ChildTagValueChangedEvents.Num() > 0)
+    {
+        for (FGameplayTag ParentTag = Tag; ParentTag.IsValid(); ParentTag = ParentTag.RequestDirectParent())
+        {
+            if (ChildTagValueChangedEvents.Contains(ParentTag))
+            {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+void UGameplayTagValueSubsystem::SnapshotTagValue(FGameplayTag Tag)
+{
+    if (!Tag.IsValid() || NotifiedTagValues.Contains(Tag))
+    {
+        return;
+    }
+    if (const FInstancedStruct* Value = ResolveValue(Tag, nullptr))
+    {
+        NotifiedTagValues.Add(Tag, *Value);
+    }
+}
+
+void UGameplayTagValueSubsystem::QueueTagValueChanged(FGameplayTag Tag)
+{
+    if (ExactTagValueChangedEvents.IsEmpty() && ChildTagValueChangedEvents.IsEmpty())
+    {
+        return;
+    }
+
+    if (!Tag.IsValid())
+    {
+        bPendingAllTagValuesChanged = true;
+    }
+    else if (!bPendingAllTagValuesChanged && IsTagValueWatched(Tag))
+    {
+        PendingTagValueChanges.Add(Tag);
+    }
+    else
+    {
+        return;
+    }
+
+    if (!TagValueFlushHandle.IsValid())
+    {
+        TagValueFlushHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &UGameplayTagValueSubsystem::FlushTagValueChanges));
+    }
+}
+
+bool UGameplayTagValueSubsystem::FlushTagValueChanges(float DeltaTime)
+{
+    QUICK_SCOPE_CYCLE_COUNTER(GameplayTagValue_FlushTagValueChanges);
+
+    TagValueFlushHandle.Reset();
+
+    // Listeners may change values, those changes are delivered on the next flush
+    TSet<FGameplayTag> TagsToCheck = MoveTemp(PendingTagValueChanges);
+    PendingTagValueChanges.Reset();
+    if (bPendingAllTagValuesChanged)
+    {
+        bPendingAllTagValuesChanged = false;
+
+        TArray<FGameplayTag> RepositoryTags;
+        VisitRepositories(nullptr, [&RepositoryTags](ITagValueRepository& Repo)
+        {
+            Repo.GetAllTags(RepositoryTags);
+            return false;
+        });
+        for (const FGameplayTag& Tag : RepositoryTags)
+        {
+            if (IsTagValueWatched(Tag))
+            {
+                TagsToCheck.Add(Tag);
+            }
+        }
+        for (const TPair<FGameplayTag, FInstancedStruct>& Notified : NotifiedTagValues)
+        {
+            TagsToCheck.Add(Notified.Key);
+        }
+    }
+
+    // Only report tags whose resolved value differs from the last one delivered
+    TArray<TPair<FGameplayTag, FInstancedStruct>> ChangedValues;
+    for (const FGameplayTag& Tag : TagsToCheck)
+    {
+        const FInstancedStruct* CurrentValue = ResolveValue(Tag, nullptr);
+        FInstancedStruct* NotifiedValue = NotifiedTagValues.Find(Tag);
+        if (!IsTagValueWatched(Tag))
+        {
+            NotifiedTagValues.Remove(Tag);
+            continue;
+        }
+
+        if (!CurrentValue && NotifiedValue)
+        {
+            NotifiedTagValues.Remove(Tag);
+            ChangedValues.Emplace(Tag, FInstancedStruct());
+        }
+        else if (CurrentValue && (!NotifiedValue || !(*NotifiedValue == *CurrentValue)))
+        {
+            NotifiedTagValues.Add(Tag, *CurrentValue);
+            ChangedValues.Emplace(Tag, *CurrentValue);
+        }
+    }
+
+    for (const TPair<FGameplayTag, FInstancedStruct>& Changed : ChangedValues)
+    {
+        // Copy the events, listeners may unregister while being called
+        if (const FOnTagValueChanged* ExactEvent = ExactTagValueChangedEvents.Find(Changed.Key))
+        {
+            const FOnTagValueChanged Event = *ExactEvent;
+            Event.Broadcast(Changed.Key, Changed.Value);
+        }
+        for (FGameplayTag ParentTag = Changed.Key; ParentTag.IsValid(); ParentTag = ParentTag.RequestDirectParent())
+        {
+            if (const FOnTagValueChanged* ChildEvent = ChildTagValueChangedEvents.Find(ParentTag))
+            {
+                const FOnTagValueChanged Event = *ChildEvent;
+                Event.Broadcast(Changed.Key, Changed.Value);
+            }
+        }
+    }
+
+    return false;
+}
+
+void UGameplayTagValueSubsystem::SetInstancedStructValue(FGameplayTag Tag, const FInstancedStruct& InValue, FName TargetRepositoryName, const UObject* Context)
+{
+    if (!Tag.IsValid())
+    {
+        UE_LOG(LogGameplayTagValue, Warning, TEXT("SetTagValue_Instanced: Tag %s. Value struct is invalid."), *Tag.ToString());
+        return;
+    }
+    
+    ITagValueRepository* WritableRepo = GetWritableRepository(TargetRepositoryName, GetScopeActor(Context));
+    if (WritableRepo)
+    {
+        WritableRepo->SetValue(Tag, InValue);
+        UE_LOG(LogGameplayTagValue, Verbose, TEXT("Registering repository: %s with priority %d"), *WritableRepo->GetRepositoryName().ToString(), WritableRepo->GetRepositoryPriority());
+    }
+    else
+    {
+        UE_LOG(LogGameplayTagValue, Warning, TEXT("SetTagValue_Instanced: No repositories available to set value for tag %s."), *Tag.ToString());
+    }
+}
+
+void UGameplayTagValueSubsystem::GetTagValue_Instanced(FGameplayTag Tag, FInstancedStruct& Value, bool& bSuccess, const UObject* Context) const
+{
+    bSuccess = GetInstancedStructValue(Tag, Value, Context);
+}
+
+void UGameplayTagValueSubsystem::SetTagValue_Instanced(FGameplayTag Tag, const FInstancedStruct& Value, FName TargetRepositoryName, const UObject* Context)
+{
+    SetInstancedStructValue(Tag, Value, TargetRepositoryName, Context);
+}
+
+int32 UGameplayTagValueSubsystem::GetTagValues(const TArray<FGameplayTag>& Tags, TArray<FInstancedStruct>& Values, TArray<bool>& Found, const UObject* Context) const
+{
+    Values.SetNum(Tags.Num());
+    Found.SetNum(Tags.Num());
+    return GetValues(Tags, Values, Found, Context);
+}
+
+void UGameplayTagValueSubsystem::SetTagValues(const TArray<FGameplayTag>& Tags, const TArray<FInstancedStruct>& Values, FName TargetRepositoryName, const UObject* Context)
+{
+    if (Tags.Num() != Values.Num())
+    {
+        UE_LOG(LogGameplayTagValue, Warning, TEXT("SetTagValues: Got %d tags but %d values."), Tags.Num(), Values.Num());
+        return;
+    }
+    SetValues(Tags, Values, TargetRepositoryName, Context);
+}
+
+bool UGameplayTagValueSubsystem::HasTagValue(FGameplayTag Tag, const UObject* Context) const
+{
+    if (!Tag.IsValid()) return false;
+
+    return ResolveValue(Tag, GetScopeActor(Context)) != nullptr;
+}
+
+void UGameplayTagValueSubsystem::ClearTagValue(FGameplayTag Tag, FName TargetRepositoryName, const UObject* Context)
+{
+    if (!Tag.IsValid()) return;
+
+    ITagValueRepository* WritableRepo = GetWritableRepository(TargetRepositoryName, GetScopeActor(Context));
+    if (WritableRepo)
+    {
+        WritableRepo->ClearValue(Tag);
+        UE_LOG(LogGameplayTagValue, Verbose, TEXT("Tag '%s' cleared from repository '%s'."), *Tag.ToString(), *WritableRepo->GetRepositoryName().ToString());
+    }
+    else
+    {
+        UE_LOG(LogGameplayTagValue, Warning, TEXT("SetTagValue_Instanced: Could not find repository named %s to set value for tag %s."), *TargetRepositoryName.ToString(), *Tag.ToString());
+    }
+}
+
+void UGameplayTagValueSubsystem::ClearAllTagValues(FName TargetRepositoryName)
+{
+    ITagValueRepository* WritableRepo = GetWritableRepository(TargetRepositoryName);
+    if (WritableRepo)
+    {
+        WritableRepo->ClearAllValues();
+        UE_LOG(LogGameplayTagValue, Verbose, TEXT("All values cleared from repository '%s'."), *WritableRepo->GetRepositoryName().ToString());
+    }
+}
+
+void UGameplayTagValueSubsystem::SortRepositories()
+{
+    Repositories.StableSort([](const TScriptInterface<ITagValueRepository>& A, const TScriptInterface<ITagValueRepository>& B) {
+        if (!A.GetInterface() || !B.GetInterface()) // Should not happen if registration is done correctly
+        {
+            return A.GetInterface() && !B.GetInterface(); // Nulls go to the end
+        }
+        return A->GetRepositoryPriority() > B->GetRepositoryPriority(); // Sort descending by priority
+    });
+}
+
+ITagValueRepository* UGameplayTagValueSubsystem::GetWritableRepository(FName RepositoryName, const AActor* ScopeActor) const
+{
+    ITagValueRepository* Result = nullptr;
+    if (RepositoryName != NAME_None)
+    {
+        // Find the specific repository, scoped, global or the default internal one
+        VisitRepositories(ScopeActor, [&Result, RepositoryName](ITagValueRepository& Repo)
+        {
+            if (Repo.GetRepositoryName() == RepositoryName)
+            {
+                Result = &Repo;
+                return true;
+            }
+            return false;
+        });
+    }
+    else // If NAME_None, find the highest priority writable one
+    {
+        // The first visited repository has the highest priority among UObject repos.
+        // The default internal repository is only used when no UObject repository is registered for this scope.
+        VisitRepositories(ScopeActor, [&Result](ITagValueRepository& Repo)
+        {
+            Result = &Repo;
+            return true;
+        });
+    }
+    return Result;
 }
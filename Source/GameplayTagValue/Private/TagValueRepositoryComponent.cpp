@@ -12,7 +12,9 @@ UTagValueRepositoryComponent::UTagValueRepositoryComponent()
     RepositoryName = NAME_None; // Default to None, will generate a unique one if needed
     Priority = 100; // Default priority, common for actor-specific values
     bRegisterWithSubsystemOnBeginPlay = true;
+    bRegisterAsGlobalRepository = false;
     bIsRegisteredWithSubsystem = false;
+    bIsRegisteredAsGlobal = false;
 }
 
 void UTagValueRepositoryComponent::BeginPlay()
@@ -43,7 +45,16 @@ void UTagValueRepositoryComponent::TryRegisterWithSubsystem()
 
         if (ThisAsRepo.GetInterface() != nullptr) // Check if the interface is valid
         {
-            Subsystem->RegisterRepository(ThisAsRepo);
+            if (bRegisterAsGlobalRepository || !GetOwner())
+            {
+                Subsystem->RegisterRepository(ThisAsRepo);
+                bIsRegisteredAsGlobal = true;
+            }
+            else
+            {
+                Subsystem->RegisterScopedRepository(GetOwner(), ThisAsRepo);
+                bIsRegisteredAsGlobal = false;
+            }
             bIsRegisteredWithSubsystem = true;
         }
         else { UE_LOG(LogGameplayTagValue, Warning, TEXT("UTagValueRepositoryComponent %s on Actor %s failed to cast to ITagValueRepository for registration."), *GetName(), GetOwner() ? *GetOwner()->GetName() : TEXT("None")); }
@@ -63,7 +74,14 @@ void UTagValueRepositoryComponent::TryUnregisterFromSubsystem()
 
         if (ThisAsRepo.GetInterface() != nullptr)
         {
-            Subsystem->UnregisterRepository(ThisAsRepo);
+            if (bIsRegisteredAsGlobal)
+            {
+                Subsystem->UnregisterRepository(ThisAsRepo);
+            }
+            else
+            {
+                Subsystem->UnregisterScopedRepository(GetOwner(), ThisAsRepo);
+            }
             bIsRegisteredWithSubsystem = false;
         }
     }
@@ -90,6 +108,12 @@ void UTagValueRepositoryComponent::SetValue(FGameplayTag Tag, const FInstancedSt
     }
     UE_LOG(LogGameplayTagValue, Verbose, TEXT("UTagValueRepositoryComponent %s: Setting tag %s."), *GetRepositoryName().ToString(), *Tag.ToString());
     ComponentTagValues.Emplace(Tag, InValue);
+    NotifyChanged(Tag);
+}
+
+void UTagValueRepositoryComponent::SetValues(TConstArrayView<FGameplayTag> Tags, TConstArrayView<FInstancedStruct> InValues)
+{
+    SetValuesInMap(ComponentTagValues, Tags, InValues, [this](FGameplayTag Tag) { NotifyChanged(Tag); });
 }
 
 bool UTagValueRepositoryComponent::HasValue(FGameplayTag Tag) const
@@ -100,12 +124,16 @@ bool UTagValueRepositoryComponent::HasValue(FGameplayTag Tag) const
 
 void UTagValueRepositoryComponent::ClearValue(FGameplayTag Tag)
 {
-    ComponentTagValues.Remove(Tag);
+    if (ComponentTagValues.Remove(Tag) > 0)
+    {
+        NotifyChanged(Tag);
+    }
 }
 
 void UTagValueRepositoryComponent::ClearAllValues()
 {
     ComponentTagValues.Empty();
+    NotifyChanged(FGameplayTag());
 }
 
 FName UTagValueRepositoryComponent::GetRepositoryName() const
@@ -127,6 +155,62 @@ int32 UTagValueRepositoryComponent::GetRepositoryPriority() const
     return Priority;
 }
 
+uint32 UTagValueRepositoryComponent::GetRepositoryVersion() const
+{
+    return *Version;
+}
+
+TSharedPtr<const uint32> UTagValueRepositoryComponent::GetRepositoryVersionCounter() const
+{
+    return Version;
+}
+
+const FInstancedStruct* UTagValueRepositoryComponent::FindValue(FGameplayTag Tag) const
+{
+    const FInstancedStruct* FoundValue = ComponentTagValues.Find(Tag);
+    return FoundValue && FoundValue->IsValid() ? FoundValue : nullptr;
+}
+
+void UTagValueRepositoryComponent::GetAllTags(TArray<FGameplayTag>& OutTags) const
+{
+    OutTags.Reserve(OutTags.Num() + ComponentTagValues.Num());
+    for (const TPair<FGameplayTag, FInstancedStruct>& Pair : ComponentTagValues)
+    {
+        if (Pair.Value.IsValid())
+        {
+            OutTags.Add(Pair.Key);
+        }
+    }
+}
+
+FOnTagValueRepositoryChanged& UTagValueRepositoryComponent::OnRepositoryChanged()
+{
+    return RepositoryChangedDelegate;
+}
+
+void UTagValueRepositoryComponent::NotifyChanged(FGameplayTag Tag)
+{
+    ++(*Version);
+    RepositoryChangedDelegate.Broadcast(*this, Tag);
+}
+
+#if WITH_EDITOR
+void UTagValueRepositoryComponent::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+    Super::PostEditChangeProperty(PropertyChangedEvent);
+
+    // The priority edited in the details panel bypasses SetPriority
+    if (PropertyChangedEvent.GetPropertyName() == GET_MEMBER_NAME_CHECKED(UTagValueRepositoryComponent, Priority))
+    {
+        SetPriority(Priority);
+        return;
+    }
+
+    // Values edited in the details panel bypass SetValue
+    NotifyChanged(FGameplayTag());
+}
+#endif
+
 // Component-specific Blueprint functions
 void UTagValueRepositoryComponent::SetComponentTagValue(FGameplayTag Tag, const FInstancedStruct& Value)
 {
@@ -142,3 +226,19 @@ bool UTagValueRepositoryComponent::HasComponentTagValue(FGameplayTag Tag) const
 {
     return HasValue(Tag); // Directly calls the interface method
 }
+
+void UTagValueRepositoryComponent::SetPriority(int32 NewPriority)
+{
+    Priority = NewPriority;
+    if (!bIsRegisteredWithSubsystem)
+    {
+        return;
+    }
+
+    if (UGameplayTagValueSubsystem* Subsystem = UGameplayTagValueSubsystem::Get(GetWorld()))
+    {
+        TScriptInterface<ITagValueRepository> ThisAsRepo;
+        ThisAsRepo.SetObject(this);
+        Subsystem->NotifyRepositoryPriorityChanged(ThisAsRepo);
+    }
+}
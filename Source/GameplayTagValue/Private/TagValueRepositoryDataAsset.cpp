@@ -35,6 +35,12 @@ void UTagValueRepositoryDataAsset::SetValue(FGameplayTag Tag, const FInstancedSt
     }
     UE_LOG(LogGameplayTagValue, Verbose, TEXT("UTagValueRepositoryDataAsset %s: Setting tag %s."), *GetRepositoryName().ToString(), *Tag.ToString());
     DataAssetTagValues.Emplace(Tag, InValue);
+    NotifyChanged(Tag);
+}
+
+void UTagValueRepositoryDataAsset::SetValues(TConstArrayView<FGameplayTag> Tags, TConstArrayView<FInstancedStruct> InValues)
+{
+    SetValuesInMap(DataAssetTagValues, Tags, InValues, [this](FGameplayTag Tag) { NotifyChanged(Tag); });
 }
 
 bool UTagValueRepositoryDataAsset::HasValue(FGameplayTag Tag) const
@@ -45,12 +51,16 @@ bool UTagValueRepositoryDataAsset::HasValue(FGameplayTag Tag) const
 
 void UTagValueRepositoryDataAsset::ClearValue(FGameplayTag Tag)
 {
-    DataAssetTagValues.Remove(Tag);
+    if (DataAssetTagValues.Remove(Tag) > 0)
+    {
+        NotifyChanged(Tag);
+    }
 }
 
 void UTagValueRepositoryDataAsset::ClearAllValues()
 {
     DataAssetTagValues.Empty();
+    NotifyChanged(FGameplayTag());
 }
 
 FName UTagValueRepositoryDataAsset::GetRepositoryName() const
@@ -68,6 +78,55 @@ int32 UTagValueRepositoryDataAsset::GetRepositoryPriority() const
     return Priority;
 }
 
+uint32 UTagValueRepositoryDataAsset::GetRepositoryVersion() const
+{
+    return *Version;
+}
+
+TSharedPtr<const uint32> UTagValueRepositoryDataAsset::GetRepositoryVersionCounter() const
+{
+    return Version;
+}
+
+const FInstancedStruct* UTagValueRepositoryDataAsset::FindValue(FGameplayTag Tag) const
+{
+    const FInstancedStruct* FoundValue = DataAssetTagValues.Find(Tag);
+    return FoundValue && FoundValue->IsValid() ? FoundValue : nullptr;
+}
+
+void UTagValueRepositoryDataAsset::GetAllTags(TArray<FGameplayTag>& OutTags) const
+{
+    OutTags.Reserve(OutTags.Num() + DataAssetTagValues.Num());
+    for (const TPair<FGameplayTag, FInstancedStruct>& Pair : DataAssetTagValues)
+    {
+        if (Pair.Value.IsValid())
+        {
+            OutTags.Add(Pair.Key);
+        }
+    }
+}
+
+FOnTagValueRepositoryChanged& UTagValueRepositoryDataAsset::OnRepositoryChanged()
+{
+    return RepositoryChangedDelegate;
+}
+
+void UTagValueRepositoryDataAsset::NotifyChanged(FGameplayTag Tag)
+{
+    ++(*Version);
+    RepositoryChangedDelegate.Broadcast(*this, Tag);
+}
+
+#if WITH_EDITOR
+void UTagValueRepositoryDataAsset::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+    Super::PostEditChangeProperty(PropertyChangedEvent);
+
+    // Values edited in the details panel bypass SetValue
+    NotifyChanged(FGameplayTag());
+}
+#endif
+
 // DataAsset-specific Blueprint functions
 void UTagValueRepositoryDataAsset::SetDataAssetTagValue(FGameplayTag Tag, const FInstancedStruct& Value)
 {
@@ -0,0 +1,120 @@
+// Copyright Nguyen Phi Hung 2025. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ITagValueRepository.h" // The interface it implements
+#include "GameplayTagContainer.h"
+#include "TagValueTypes.h"       // For the scalar value types
+
+
+/**
+ * An in-memory implementation of the ITagValueRepository interface for large sets of scalar values.
+ * FTagValueFloat, FTagValueInt, FTagValueBool and FTagValueVector values are stored in dense per-type columns
+ * indexed by tag, any other struct falls back to an FInstancedStruct column.
+ * The typed accessors read and write the columns directly, without reflection or allocation. Scalar values
+ * read through FindValue are boxed into an FInstancedStruct, kept until the next change of the repository.
+ * Prefer the typed accessors, or the scalar accessors of UGameplayTagValueSubsystem, for hot scalar reads.
+ * Like FMemoryTagValueRepository, this is not a UCLASS/USTRUCT and is intended for direct C++ usage.
+ */
+class GAMEPLAYTAGVALUE_API FColumnarTagValueRepository : public ITagValueRepository
+{
+public:
+    FColumnarTagValueRepository(FName InRepositoryName, int32 InPriority);
+    virtual ~FColumnarTagValueRepository() = default;
+
+    //~ Begin ITagValueRepository Interface
+    virtual bool GetValue(FGameplayTag Tag, FInstancedStruct& OutValue) const override;
+    virtual void SetValue(FGameplayTag Tag, const FInstancedStruct& InValue) override;
+    virtual void SetValues(TConstArrayView<FGameplayTag> Tags, TConstArrayView<FInstancedStruct> InValues) override;
+    virtual bool HasValue(FGameplayTag Tag) const override;
+    virtual void ClearValue(FGameplayTag Tag) override;
+    virtual void ClearAllValues() override;
+    virtual FName GetRepositoryName() const override;
+    virtual int32 GetRepositoryPriority() const override;
+    virtual uint32 GetRepositoryVersion() const override;
+    virtual TSharedPtr<const uint32> GetRepositoryVersionCounter() const override;
+    virtual const FInstancedStruct* FindValue(FGameplayTag Tag) const override;
+    virtual void GetAllTags(TArray<FGameplayTag>& OutTags) const override;
+    virtual FOnTagValueRepositoryChanged& OnRepositoryChanged() override;
+    //~ End ITagValueRepository Interface
+
+    // Typed accessors. Getters return false if the tag has no value of that exact type.
+    bool GetFloat(FGameplayTag Tag, float& OutValue) const;
+    bool GetInt(FGameplayTag Tag, int32& OutValue) const;
+    bool GetBool(FGameplayTag Tag, bool& OutValue) const;
+    bool GetVector(FGameplayTag Tag, FVector& OutValue) const;
+    void SetFloat(FGameplayTag Tag, float InValue);
+    void SetInt(FGameplayTag Tag, int32 InValue);
+    void SetBool(FGameplayTag Tag, bool InValue);
+    void SetVector(FGameplayTag Tag, const FVector& InValue);
+
+    /** Number of tags with a value */
+    int32 Num() const { return Slots.Num(); }
+
+private:
+    enum class EColumn : uint8
+    {
+        Float,
+        Int,
+        Bool,
+        Vector,
+        Struct
+    };
+
+    /** Location of the value of a tag */
+    struct FSlot
+    {
+        EColumn Column;
+        int32 Index;
+    };
+
+    /** Dense values of one type, along with the tag owning each value so removals can swap the last one in */
+    template<typename T>
+    struct TColumn
+    {
+        TArray<T> Values;
+        TArray<FGameplayTag> Tags;
+    };
+
+    template<typename T>
+    bool GetTyped(const TColumn<T>& Column, EColumn ColumnType, FGameplayTag Tag, T& OutValue) const;
+
+    template<typename T>
+    void SetTyped(TColumn<T>& Column, EColumn ColumnType, FGameplayTag Tag, const T& InValue);
+
+    /** Stores a value in its column without notifying. Returns true if the repository changed. */
+    bool AssignValue(FGameplayTag Tag, const FInstancedStruct& InValue);
+
+    /** Stores a value in the column without notifying, moving the tag out of its previous column if its type changed */
+    template<typename T>
+    void AssignTyped(TColumn<T>& Column, EColumn ColumnType, FGameplayTag Tag, const T& InValue);
+
+    template<typename T>
+    void RemoveAt(TColumn<T>& Column, int32 Index);
+
+    /** Removes the value of a slot from its column, the slot itself is left to the caller */
+    void RemoveFromColumn(const FSlot& Slot);
+
+    /** Copies the value of a slot into an instanced struct */
+    void BoxValue(const FSlot& Slot, FInstancedStruct& OutValue) const;
+
+    /** Bumps the version and notifies listeners. An invalid tag means every value may have changed. */
+    void NotifyChanged(FGameplayTag Tag);
+
+    TMap<FGameplayTag, FSlot> Slots;
+    TColumn<float> Floats;
+    TColumn<int32> Ints;
+    TColumn<bool> Bools;
+    TColumn<FVector> Vectors;
+    TColumn<FInstancedStruct> Structs;
+
+    /** Scalar values boxed for FindValue since the last change, heap allocated so pointers survive the boxing of other tags */
+    mutable TMap<FGameplayTag, TUniquePtr<FInstancedStruct>> BoxedValues;
+
+    FName RepositoryName;
+    int32 Priority;
+    /** Shared with the views into this repository, see GetRepositoryVersionCounter */
+    TSharedRef<uint32> Version = MakeShared<uint32>(0);
+    FOnTagValueRepositoryChanged RepositoryChangedDelegate;
+};
@@ -22,15 +22,27 @@ public:
     //~ Begin ITagValueRepository Interface
     virtual bool GetValue(FGameplayTag Tag, FInstancedStruct& OutValue) const override;
     virtual void SetValue(FGameplayTag Tag, const FInstancedStruct& InValue) override;
+    virtual void SetValues(TConstArrayView<FGameplayTag> Tags, TConstArrayView<FInstancedStruct> InValues) override;
     virtual bool HasValue(FGameplayTag Tag) const override;
     virtual void ClearValue(FGameplayTag Tag) override;
     virtual void ClearAllValues() override;
     virtual FName GetRepositoryName() const override;
     virtual int32 GetRepositoryPriority() const override;
+    virtual uint32 GetRepositoryVersion() const override;
+    virtual TSharedPtr<const uint32> GetRepositoryVersionCounter() const override;
+    virtual const FInstancedStruct* FindValue(FGameplayTag Tag) const override;
+    virtual void GetAllTags(TArray<FGameplayTag>& OutTags) const override;
+    virtual FOnTagValueRepositoryChanged& OnRepositoryChanged() override;
     //~ End ITagValueRepository Interface
 
 private:
+    /** Bumps the version and notifies listeners. An invalid tag means every value may have changed. */
+    void NotifyChanged(FGameplayTag Tag);
+
     TMap<FGameplayTag, FInstancedStruct> TagValues;
     FName RepositoryName;
     int32 Priority;
+    /** Shared with the views into this repository, see GetRepositoryVersionCounter */
+    TSharedRef<uint32> Version = MakeShared<uint32>(0);
+    FOnTagValueRepositoryChanged RepositoryChangedDelegate;
 };
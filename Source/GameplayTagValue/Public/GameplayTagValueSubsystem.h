@@ -7,10 +7,77 @@
 #include "GameplayTagContainer.h"
 #include "UObject/StructOnScope.h" // For FInstancedStruct
 #include "ITagValueRepository.h"   // For the interface
+#include "Containers/Ticker.h"       // For the batched change notifications
+#include "TagValueTypes.h"           // For the modifier types
+#include "Misc/ScopeRWLock.h"        // For the read snapshot
+#include "UObject/ObjectKey.h"       // For the repository membership set
 #include "GameplayTagValueSubsystem.generated.h"
 
 // Forward declarations
 class FMemoryTagValueRepository;
+class FColumnarTagValueRepository;
+
+/** Native delegate broadcast when the effective value of a tag changed. The value is empty if the tag has no value anymore. */
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnTagValueChanged, FGameplayTag /*Tag*/, const FInstancedStruct& /*NewValue*/);
+
+/** Blueprint delegate called when the effective value of a tag changed. The value is empty if the tag has no value anymore. */
+DECLARE_DYNAMIC_DELEGATE_TwoParams(FOnTagValueChangedDynamic, FGameplayTag, Tag, const FInstancedStruct&, NewValue);
+
+/**
+ * Immutable copy of the values resolved through the global repositories, safe to read from any thread.
+ * Published by the subsystem on the game thread, see UGameplayTagValueSubsystem::GetReadSnapshot.
+ * Values are split in shards by tag hash, so publishing a change only copies the shards holding changed tags.
+ */
+class GAMEPLAYTAGVALUE_API FTagValueSnapshot
+{
+public:
+    /** Finds the value of a tag, nullptr if it has none */
+    const FInstancedStruct* FindValue(FGameplayTag Tag) const
+    {
+        const FShardPtr& Shard = Shards[GetShardIndex(Tag)];
+        const FValuePtr* Value = Shard.IsValid() ? Shard->Find(Tag) : nullptr;
+        return Value ? Value->Get() : nullptr;
+    }
+
+    /** Gets the value of a tag if it is of type T */
+    template<typename T>
+    const T* GetValuePtr(FGameplayTag Tag) const
+    {
+        const FInstancedStruct* Value = FindValue(Tag);
+        return Value && Value->GetScriptStruct()->IsChildOf(T::StaticStruct()) ? Value->GetPtr<T>() : nullptr;
+    }
+
+    /** Number of tags with a value */
+    int32 Num() const { return NumValues; }
+
+private:
+    friend class UGameplayTagValueSubsystem;
+
+    /** Values and shards are immutable once published, so successive snapshots share the ones that did not change */
+    using FValuePtr = TSharedPtr<const FInstancedStruct, ESPMode::ThreadSafe>;
+    using FShard = TMap<FGameplayTag, FValuePtr>;
+    using FShardPtr = TSharedPtr<const FShard, ESPMode::ThreadSafe>;
+
+    static constexpr int32 NumShards = 64;
+
+    static int32 GetShardIndex(FGameplayTag Tag) { return GetTypeHash(Tag) % NumShards; }
+
+    /** Null for shards without values */
+    FShardPtr Shards[NumShards];
+    int32 NumValues = 0;
+};
+
+using FTagValueSnapshotPtr = TSharedPtr<const FTagValueSnapshot, ESPMode::ThreadSafe>;
+
+/** Repositories scoped to a single actor, sorted by priority (descending). Wrapped to be used as a TMap value with UPROPERTY. */
+USTRUCT()
+struct FTagValueRepositoryList
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    TArray<TScriptInterface<ITagValueRepository>> Repositories;
+};
 
 UCLASS(Config=Game) // Expose properties to config files (e.g., DefaultGame.ini)
 class GAMEPLAYTAGVALUE_API UGameplayTagValueSubsystem : public UGameInstanceSubsystem
@@ -35,15 +102,43 @@ public:
     UFUNCTION(BlueprintCallable, Category = "GameplayTagValue|Repository")
     void UnregisterRepository(TScriptInterface<ITagValueRepository> Repository);
 
+    /**
+     * Registers several repositories in a single pass, e.g. from a level streaming callback.
+     * Caches are invalidated once for the whole batch instead of once per repository.
+     */
+    void RegisterRepositories(TConstArrayView<TScriptInterface<ITagValueRepository>> NewRepositories);
+
+    /** Unregisters several repositories in a single pass over the registered ones. */
+    void UnregisterRepositories(TConstArrayView<TScriptInterface<ITagValueRepository>> OldRepositories);
+
+    /**
+     * Registers a repository that is only visible to queries made with the given actor (or one of its components) as context.
+     * Queries with that context resolve through the actor's repositories and the global ones, by priority.
+     */
+    UFUNCTION(BlueprintCallable, Category = "GameplayTagValue|Repository")
+    void RegisterScopedRepository(AActor* ScopeActor, TScriptInterface<ITagValueRepository> Repository);
+
+    /** Unregisters a repository registered with RegisterScopedRepository. */
+    UFUNCTION(BlueprintCallable, Category = "GameplayTagValue|Repository")
+    void UnregisterScopedRepository(AActor* ScopeActor, TScriptInterface<ITagValueRepository> Repository);
+
+    /**
+     * Moves a registered repository, global or scoped, to its place for its current priority.
+     * Repositories are ordered by priority when registered, call this after changing the priority of a registered one.
+     */
+    UFUNCTION(BlueprintCallable, Category = "GameplayTagValue|Repository")
+    void NotifyRepositoryPriorityChanged(TScriptInterface<ITagValueRepository> Repository);
+
     // --- Value Access (FInstancedStruct - for C++ and advanced BP) ---
 
     /**
      * Gets the value associated with the given tag, searching through repositories by priority.
      * @param Tag The tag to query.
      * @param OutValue The FInstancedStruct to populate if the tag is found.
+     * @param Context Optional actor, or object owned by an actor, whose scoped repositories are searched along with the global ones.
      * @return True if the tag was found and OutValue is populated, false otherwise.
      */
-    bool GetInstancedStructValue(FGameplayTag Tag, FInstancedStruct& OutValue) const;
+    bool GetInstancedStructValue(FGameplayTag Tag, FInstancedStruct& OutValue, const UObject* Context = nullptr) const;
 
     /**
      * Sets the value for the given tag.
@@ -51,34 +146,91 @@ public:
      * @param Tag The tag to associate the value with.
      * @param InValue The FInstancedStruct containing the value to set.
      * @param TargetRepositoryName Optional: The name of the repository to set the value in.
+     * @param Context Optional actor, or object owned by an actor, whose scoped repositories can be written to.
+     */
+    void SetInstancedStructValue(FGameplayTag Tag, const FInstancedStruct& InValue, FName TargetRepositoryName = NAME_None, const UObject* Context = nullptr);
+
+    /**
+     * Gets the values of several tags at once. Repositories are walked once for the whole batch, and misses are not logged.
+     * @param Tags The tags to query.
+     * @param OutValues Receives the value of each tag, reset for tags without a value. Must be as large as Tags.
+     * @param OutFound Receives whether each tag has a value. Must be as large as Tags.
+     * @param Context Optional actor, or object owned by an actor, whose scoped repositories are searched along with the global ones.
+     * @return The number of tags that have a value.
+     */
+    int32 GetValues(TConstArrayView<FGameplayTag> Tags, TArrayView<FInstancedStruct> OutValues, TArrayView<bool> OutFound, const UObject* Context = nullptr) const;
+
+    /**
+     * Sets the values of several tags at once, as a single bulk insert into the target repository.
+     * @param Tags The tags to associate the values with.
+     * @param InValues The values to set, one per tag.
+     * @param TargetRepositoryName Optional: The name of the repository to set the values in.
+     * @param Context Optional actor, or object owned by an actor, whose scoped repositories can be written to.
+     */
+    void SetValues(TConstArrayView<FGameplayTag> Tags, TConstArrayView<FInstancedStruct> InValues, FName TargetRepositoryName = NAME_None, const UObject* Context = nullptr);
+
+    // --- Value Access (Zero-copy - for C++) ---
+
+    /**
+     * Gets a view of the value associated with the given tag, pointing directly into the storage of the winning repository.
+     * Nothing is copied or allocated. The view is invalidated by the next mutation of that repository, which is asserted in builds with checks.
+     * Don't keep views across frames, resolve them again instead (hot tags are served from the resolved value cache).
+     * @param Tag The tag to query.
+     * @param Context Optional actor, or object owned by an actor, whose scoped repositories are searched along with the global ones.
+     */
+    FTagValueView GetValueView(FGameplayTag Tag, const UObject* Context = nullptr) const;
+
+    /**
+     * Gets a pointer to the value associated with the given tag if it is of type T, with the same lifetime rules as GetValueView.
      */
-    void SetInstancedStructValue(FGameplayTag Tag, const FInstancedStruct& InValue, FName TargetRepositoryName = NAME_None);
+    template<typename T>
+    const T* GetValuePtr(FGameplayTag Tag, const UObject* Context = nullptr) const
+    {
+        return GetValueView(Tag, Context).template GetPtr<T>();
+    }
 
     // --- Value Access (Templated - for C++) ---
 
     template<typename T>
-    bool GetValue(FGameplayTag Tag, T& OutValue) const
+    bool GetValue(FGameplayTag Tag, T& OutValue, const UObject* Context = nullptr) const
     {
-        FInstancedStruct InstancedStruct;
-        if (GetInstancedStructValue(Tag, InstancedStruct))
+        if (const T* Value = GetValuePtr<T>(Tag, Context))
         {
-            if (InstancedStruct.IsValid() && InstancedStruct.GetScriptStruct() && InstancedStruct.GetScriptStruct()->IsChildOf(T::StaticStruct()))
-            {
-                OutValue = *InstancedStruct.GetPtr<T>();
-                return true;
-            }
+            OutValue = *Value;
+            return true;
         }
         return false;
     }
 
     template<typename T>
-    void SetValue(FGameplayTag Tag, const T& InValue, FName TargetRepositoryName = NAME_None)
+    void SetValue(FGameplayTag Tag, const T& InValue, FName TargetRepositoryName = NAME_None, const UObject* Context = nullptr)
     {
         FInstancedStruct InstancedStruct;
         InstancedStruct.InitializeAs(T::StaticStruct(), reinterpret_cast<const uint8*>(&InValue));
-        SetInstancedStructValue(Tag, InstancedStruct, TargetRepositoryName);
+        SetInstancedStructValue(Tag, InstancedStruct, TargetRepositoryName, Context);
     }
 
+    // --- Value Access (Scalars - for C++) ---
+
+    /**
+     * Gets the value of a tag holding exactly one of the scalar value types (see TagValueTypes.h).
+     * When the value comes from the columnar default repository it is read from its typed column, without boxing it into an FInstancedStruct.
+     * @return True if the winning value of the tag is of that type.
+     */
+    bool GetFloatValue(FGameplayTag Tag, float& OutValue, const UObject* Context = nullptr) const;
+    bool GetIntValue(FGameplayTag Tag, int32& OutValue, const UObject* Context = nullptr) const;
+    bool GetBoolValue(FGameplayTag Tag, bool& OutValue, const UObject* Context = nullptr) const;
+    bool GetVectorValue(FGameplayTag Tag, FVector& OutValue, const UObject* Context = nullptr) const;
+
+    /**
+     * Sets a scalar value, written to the typed column when the target is the columnar default repository.
+     * Targets the same repository as SetInstancedStructValue.
+     */
+    void SetFloatValue(FGameplayTag Tag, float InValue, FName TargetRepositoryName = NAME_None, const UObject* Context = nullptr);
+    void SetIntValue(FGameplayTag Tag, int32 InValue, FName TargetRepositoryName = NAME_None, const UObject* Context = nullptr);
+    void SetBoolValue(FGameplayTag Tag, bool InValue, FName TargetRepositoryName = NAME_None, const UObject* Context = nullptr);
+    void SetVectorValue(FGameplayTag Tag, const FVector& InValue, FName TargetRepositoryName = NAME_None, const UObject* Context = nullptr);
+
     // --- Value Access (Blueprint - using wildcard pins) ---
 
     /**
@@ -86,46 +238,355 @@ public:
      * @param Tag The tag to query.
      * @param Value The FInstancedStruct to populate. Note: This is an FInstancedStruct, not the raw struct type.
      * @param bSuccess True if the tag was found and value retrieved successfully.
+     * @param Context Optional actor, or object owned by an actor, whose scoped repositories are searched along with the global ones.
      */
-    UFUNCTION(BlueprintCallable, Category = "GameplayTagValue", meta = (DisplayName = "Get Tag Value (Instanced)", ExpandBoolAsExecs = "bSuccess", AutoCreateRefTerm = "Tag"))
-    void GetTagValue_Instanced(FGameplayTag Tag, UPARAM(ref) FInstancedStruct& Value, bool& bSuccess) const;
+    UFUNCTION(BlueprintCallable, Category = "GameplayTagValue", meta = (DisplayName = "Get Tag Value (Instanced)", ExpandBoolAsExecs = "bSuccess", AutoCreateRefTerm = "Tag", AdvancedDisplay = "Context"))
+    void GetTagValue_Instanced(FGameplayTag Tag, UPARAM(ref) FInstancedStruct& Value, bool& bSuccess, const UObject* Context = nullptr) const;
 
     /**
      * Sets the value for the given tag. The input struct type is determined by what you connect to 'Value'.
      * @param Tag The tag to associate the value with.
      * @param Value The FInstancedStruct containing the value to set.
      * @param TargetRepositoryName Optional: The name of the repository to set the value in. If NAME_None, uses the default/highest priority.
+     * @param Context Optional actor, or object owned by an actor, whose scoped repositories can be written to.
      */
-    UFUNCTION(BlueprintCallable, Category = "GameplayTagValue", meta = (DisplayName = "Set Tag Value (Instanced)", AutoCreateRefTerm = "Tag,Value"))
-    void SetTagValue_Instanced(FGameplayTag Tag, const FInstancedStruct& Value, FName TargetRepositoryName = NAME_None);
+    UFUNCTION(BlueprintCallable, Category = "GameplayTagValue", meta = (DisplayName = "Set Tag Value (Instanced)", AutoCreateRefTerm = "Tag,Value", AdvancedDisplay = "Context"))
+    void SetTagValue_Instanced(FGameplayTag Tag, const FInstancedStruct& Value, FName TargetRepositoryName = NAME_None, const UObject* Context = nullptr);
+
+
+    /** Blueprint version of GetValues. Values and Found are resized to the number of tags. */
+    UFUNCTION(BlueprintCallable, Category = "GameplayTagValue", meta = (AdvancedDisplay = "Context"))
+    int32 GetTagValues(const TArray<FGameplayTag>& Tags, TArray<FInstancedStruct>& Values, TArray<bool>& Found, const UObject* Context = nullptr) const;
 
+    /** Blueprint version of SetValues. Tags and Values must have the same number of elements. */
+    UFUNCTION(BlueprintCallable, Category = "GameplayTagValue", meta = (AdvancedDisplay = "Context"))
+    void SetTagValues(const TArray<FGameplayTag>& Tags, const TArray<FInstancedStruct>& Values, FName TargetRepositoryName = NAME_None, const UObject* Context = nullptr);
 
-    /** Checks if a value exists for the given tag in any repository. */
-    UFUNCTION(BlueprintPure, Category = "GameplayTagValue", meta=(AutoCreateRefTerm = "Tag"))
-    bool HasTagValue(FGameplayTag Tag) const;
+    /** Checks if a value exists for the given tag in any global repository, or any repository scoped to the context. */
+    UFUNCTION(BlueprintPure, Category = "GameplayTagValue", meta=(AutoCreateRefTerm = "Tag", AdvancedDisplay = "Context"))
+    bool HasTagValue(FGameplayTag Tag, const UObject* Context = nullptr) const;
 
     /** Clears a value for the given tag from a specific repository. If TargetRepositoryName is NAME_None, it attempts the default/highest priority. */
-    UFUNCTION(BlueprintCallable, Category = "GameplayTagValue", meta=(AutoCreateRefTerm = "Tag"))
-    void ClearTagValue(FGameplayTag Tag, FName TargetRepositoryName = NAME_None);
+    UFUNCTION(BlueprintCallable, Category = "GameplayTagValue", meta=(AutoCreateRefTerm = "Tag", AdvancedDisplay = "Context"))
+    void ClearTagValue(FGameplayTag Tag, FName TargetRepositoryName = NAME_None, const UObject* Context = nullptr);
 
     /** Clears all values from a specific repository. If TargetRepositoryName is NAME_None, it attempts the default/highest priority. */
     UFUNCTION(BlueprintCallable, Category = "GameplayTagValue")
     void ClearAllTagValues(FName TargetRepositoryName = NAME_None);
 
+    // --- Modifiers ---
+
+    /**
+     * Adds a modifier to the numeric value of a tag, without touching the stored value.
+     * Modifiers apply in ascending priority order (insertion order for equal priorities) on top of the resolved
+     * FTagValueFloat or FTagValueInt value. The result is cached per tag until a modifier of the tag or its base value changes.
+     * @param Source Optional object owning the modifier, so all its modifiers can be removed at once.
+     */
+    UFUNCTION(BlueprintCallable, Category = "GameplayTagValue|Modifiers", meta = (AdvancedDisplay = "Source"))
+    FTagValueModifierHandle AddValueModifier(FGameplayTag Tag, ETagValueModifierOp Op, float Magnitude, int32 Priority = 0, const UObject* Source = nullptr);
+
+    /** Removes a modifier. Returns true if it was found. */
+    UFUNCTION(BlueprintCallable, Category = "GameplayTagValue|Modifiers")
+    bool RemoveValueModifier(FTagValueModifierHandle Handle);
+
+    /** Removes every modifier added with the given source. Returns the number of modifiers removed. */
+    UFUNCTION(BlueprintCallable, Category = "GameplayTagValue|Modifiers")
+    int32 RemoveValueModifiersFromSource(const UObject* Source);
+
+    /**
+     * Gets the numeric value of a tag with its modifiers applied.
+     * @param DefaultValue Base value used when the tag has no FTagValueFloat or FTagValueInt value.
+     */
+    UFUNCTION(BlueprintPure, Category = "GameplayTagValue|Modifiers", meta = (AdvancedDisplay = "Context"))
+    float GetModifiedValue(FGameplayTag Tag, float DefaultValue = 0.f, const UObject* Context = nullptr) const;
+
+    // --- Change Notifications ---
+
+    /**
+     * Gets the event broadcast when the effective value of a tag changes, after priority resolution over the global repositories.
+     * Changes are collected and delivered once per frame, and only if the resolved value actually differs from the last one delivered.
+     * Only global repositories are observed: repositories registered scoped to an actor, which is the default for
+     * UTagValueRepositoryComponent unless bRegisterAsGlobalRepository is set, change silently.
+     * @param Tag The tag to watch.
+     * @param bIncludeChildren If true, the event is also broadcast for changes of any child tag, with the child tag as parameter.
+     */
+    FOnTagValueChanged& RegisterTagValueChangedEvent(FGameplayTag Tag, bool bIncludeChildren = false);
+
+    /** Removes a delegate added to the event returned by RegisterTagValueChangedEvent. */
+    void UnregisterTagValueChangedEvent(FGameplayTag Tag, bool bIncludeChildren, FDelegateHandle Handle);
+
+    /** Blueprint version of RegisterTagValueChangedEvent. */
+    UFUNCTION(BlueprintCallable, Category = "GameplayTagValue|Events", meta = (AutoCreateRefTerm = "Tag"))
+    void BindTagValueChanged(FGameplayTag Tag, bool bIncludeChildren, FOnTagValueChangedDynamic Callback);
+
+    /** Unbinds every callback of the listener from changes of the tag. */
+    UFUNCTION(BlueprintCallable, Category = "GameplayTagValue|Events", meta = (AutoCreateRefTerm = "Tag"))
+    void UnbindTagValueChanged(FGameplayTag Tag, bool bIncludeChildren, UObject* Listener);
+
+    /**
+     * Enables or disables the flattened view: a single table holding the priority-resolved merge of the global repositories.
+     * Reads without scoped repositories are then served from that table, and a repository change only rebuilds the changed tags.
+     * Changes are applied to the table on the next tick of the core ticker, or by FlushFlattenedView. Until then the changed tags are
+     * read from their repositories, so reads never modify the table. Views into the table are invalidated when changes are applied.
+     */
+    UFUNCTION(BlueprintCallable, Category = "GameplayTagValue")
+    void SetUseFlattenedView(bool bEnabled);
+
+    /** Applies the pending repository changes to the flattened view now, instead of on the next tick. */
+    UFUNCTION(BlueprintCallable, Category = "GameplayTagValue")
+    void FlushFlattenedView();
+
+    /** Whether reads are served from the flattened view. */
+    UFUNCTION(BlueprintPure, Category = "GameplayTagValue")
+    bool IsUsingFlattenedView() const { return bUseFlattenedView; }
+
+    /**
+     * Enables or disables value inheritance. When enabled, a tag without a value of its own resolves to the value of the same
+     * leaf under its ancestor categories, e.g. Weapon.Rifle.Damage falls back to Weapon.Damage, then to Damage.
+     * Resolved fallbacks are cached per tag and invalidated when any tag of the chain changes.
+     */
+    UFUNCTION(BlueprintCallable, Category = "GameplayTagValue")
+    void SetUseValueInheritance(bool bEnabled);
+
+    /** Whether tags without a value fall back to the value of their ancestor categories. */
+    UFUNCTION(BlueprintPure, Category = "GameplayTagValue")
+    bool IsUsingValueInheritance() const { return bUseValueInheritance; }
+
+    // --- Concurrent Reads ---
+
+    /**
+     * Enables or disables concurrent reads. When enabled, the subsystem publishes an immutable snapshot of the values resolved
+     * through the global repositories, which any thread can read while the game thread keeps writing.
+     * Writes are folded into a new snapshot on the next tick of the core ticker, readers keep the snapshot they hold until they release it.
+     * Publishing copies the shards holding changed tags, about 1/64th of the values per changed tag, which suits sets of up to a few tens of thousands of values.
+     * Snapshots hold direct values only, without scoped repositories, inheritance or modifiers.
+     */
+    UFUNCTION(BlueprintCallable, Category = "GameplayTagValue")
+    void SetConcurrentReadsEnabled(bool bEnabled);
+
+    /** Whether a read snapshot is published for other threads. */
+    UFUNCTION(BlueprintPure, Category = "GameplayTagValue")
+    bool IsConcurrentReadsEnabled() const { return bEnableConcurrentReads; }
+
+    /** Gets the latest published snapshot, null if concurrent reads are disabled. Can be called from any thread. */
+    FTagValueSnapshotPtr GetReadSnapshot() const;
+
+    /** Publishes the pending writes right away instead of on the next tick of the core ticker. Game thread only. */
+    void PublishReadSnapshot();
+
+    /** Gets a value from the latest published snapshot. Can be called from any thread. */
+    bool GetInstancedStructValueThreadSafe(FGameplayTag Tag, FInstancedStruct& OutValue) const;
+
+    /** Gets a value of type T from the latest published snapshot. Can be called from any thread. */
+    template<typename T>
+    bool GetValueThreadSafe(FGameplayTag Tag, T& OutValue) const
+    {
+        const FTagValueSnapshotPtr Snapshot = GetReadSnapshot();
+        if (const T* Value = Snapshot.IsValid() ? Snapshot->GetValuePtr<T>(Tag) : nullptr)
+        {
+            OutValue = *Value;
+            return true;
+        }
+        return false;
+    }
+
 
 protected:
-    /** Sorts repositories by priority (descending). To be called after registration/unregistration or priority changes. */
+    /** Sorts repositories by priority (descending), keeping the registration order of equal priorities. Registration keeps them sorted, only needed after priority changes, see NotifyRepositoryPriorityChanged. */
     void SortRepositories();
 
-    /** Finds a writable repository. If Name is None, returns the highest priority one. */
-    ITagValueRepository* GetWritableRepository(FName RepositoryName) const;
+    /** Finds a writable repository among the global ones and the ones scoped to the actor. If Name is None, returns the highest priority one. */
+    ITagValueRepository* GetWritableRepository(FName RepositoryName, const AActor* ScopeActor = nullptr) const;
+
+    /** Gets the actor whose scoped repositories a query with this context resolves through: the context itself or its owning actor. */
+    static const AActor* GetScopeActor(const UObject* Context);
+
+    /**
+     * Visits the repositories scoped to the actor and the global repositories merged by priority (scoped first on ties), then the default repository.
+     * @param Visitor Called with each repository, returns true to stop the walk.
+     * @return True if the visitor stopped the walk.
+     */
+    template<typename VisitorType>
+    bool VisitRepositories(const AActor* ScopeActor, VisitorType&& Visitor) const;
+
+    /**
+     * Resolves a tag through the repositories of the scope without copying the value.
+     * Served from the resolved value cache when the scope has no repositories of its own.
+     * @return The winning value, or nullptr if no repository has a value for the tag.
+     */
+    const FInstancedStruct* ResolveValue(FGameplayTag Tag, const AActor* ScopeActor, const ITagValueRepository** OutRepository = nullptr) const;
+
+    /** Reads a scalar value through the typed column getter when the cached winner is the columnar default repository, through its FInstancedStruct otherwise */
+    template<typename ValueType, typename T, typename ColumnGetterType>
+    bool GetScalarValue(FGameplayTag Tag, T& OutValue, const UObject* Context, ColumnGetterType ColumnGetter) const;
+
+    /** Writes a scalar value through the typed column setter when the target is the columnar default repository, as an FInstancedStruct otherwise */
+    template<typename ValueType, typename T, typename ColumnSetterType>
+    void SetScalarValue(FGameplayTag Tag, const T& InValue, FName TargetRepositoryName, const UObject* Context, ColumnSetterType ColumnSetter);
+
+private:
+    /** Winning repository and value of a tag resolved without scope */
+    struct FResolvedTagValue
+    {
+        /** Null for a cached miss, which stays valid until a repository notifies a change of the tag */
+        ITagValueRepository* Repository = nullptr;
+
+        /**
+         * Points into the storage of Repository, only valid for RepositoryVersion.
+         * Null with a repository when a scalar accessor resolved the columnar default repository without boxing its value.
+         */
+        const FInstancedStruct* Value = nullptr;
+        uint32 RepositoryVersion = 0;
+    };
+
+    /** Subscribes to the change delegate of a global repository */
+    void BindRepository(ITagValueRepository& Repository);
+
+    /** Unsubscribes from the change delegate of a global repository */
+    void UnbindRepository(ITagValueRepository& Repository);
+
+    /** Drops every cached resolution after the set of global repositories changed */
+    void HandleRepositoriesChanged();
+
+    /** Drops the global repositories whose object was garbage collected, and the modifiers whose source was */
+    void HandlePostGarbageCollect();
+
+    /** Drops the cached resolution of the changed tag, or of every tag, and marks it dirty in the flattened view */
+    void HandleRepositoryChanged(ITagValueRepository& Repository, FGameplayTag Tag);
+
+    /** Whether a change of the tag has a listener, directly or through one of its parents */
+    bool IsTagValueWatched(FGameplayTag Tag) const;
+
+    /** Drops the last delivered values of the tag, or of the tag and its children, that are not watched anymore */
+    void ForgetUnwatchedTagValues(FGameplayTag Tag, bool bIncludeChildren);
+
+    /** Records the current effective value of the tag as the last one delivered, if it has none yet */
+    void SnapshotTagValue(FGameplayTag Tag);
+
+    /** Queues a change of the tag, or of every tag, to be delivered on the next flush */
+    void QueueTagValueChanged(FGameplayTag Tag);
+
+    /** Resolves the queued tags and notifies listeners of the ones whose effective value changed. Returns false to remove the ticker. */
+    bool FlushTagValueChanges(float DeltaTime);
+
+    /** Rebuilds the dirty tags of the flattened view, or the whole view after a registration change */
+    void UpdateFlattenedView();
+
+    /** Marks the tag as changed since the flattened view was last updated, or every tag if it is invalid */
+    void MarkFlattenedViewDirty(FGameplayTag Tag);
+
+    /** Updates the flattened view once per frame. Returns false to remove the ticker. */
+    bool HandleUpdateFlattenedView(float DeltaTime);
+
+    /** Resolves the value set on the tag itself, without inheritance */
+    const FInstancedStruct* ResolveDirectValue(FGameplayTag Tag, const AActor* ScopeActor, const ITagValueRepository** OutRepository = nullptr) const;
+
+    /** Gets the tags looked up for a tag when inheritance is enabled, starting with the tag itself */
+    const TArray<FGameplayTag>& GetValueFallbackChain(FGameplayTag Tag) const;
+
+    /** Drops the cached inherited values of every tag whose fallback chain contains the tag */
+    void InvalidateInheritedValues(FGameplayTag Tag);
+
+    /** Resolves a tag through the global repositories, ignoring every cache */
+    const FInstancedStruct* ResolveGlobalValueUncached(FGameplayTag Tag, ITagValueRepository** OutRepository = nullptr) const;
+
+    /** Tag to winning value of the global repositories, so hot reads are a single hash lookup */
+    mutable TMap<FGameplayTag, FResolvedTagValue> ResolvedValueCache;
+
+    /** Tag to the value it inherits without scope, so inherited reads cost the same as direct ones */
+    mutable TMap<FGameplayTag, FResolvedTagValue> InheritedValueCache;
+
+    /** Fallback chains of the tags resolved with inheritance, and for each tag of a chain the tags whose chain contains it */
+    mutable TMap<FGameplayTag, TArray<FGameplayTag>> ValueFallbackChains;
+    mutable TMap<FGameplayTag, TArray<FGameplayTag>> ValueFallbackDependents;
+
+    /** Copies of the winning values of the global repositories, only maintained while the flattened view is enabled */
+    TSharedPtr<FMemoryTagValueRepository> FlattenedView;
+
+    /** A modifier of a numeric tag value */
+    struct FTagValueModifier
+    {
+        FTagValueModifierHandle Handle;
+        ETagValueModifierOp Op = ETagValueModifierOp::Add;
+        float Magnitude = 0.f;
+        int32 Priority = 0;
+        TWeakObjectPtr<const UObject> Source;
+    };
+
+    /** Modifiers of a tag sorted by priority, along with their aggregate over the unscoped base value */
+    struct FTagValueModifierStack
+    {
+        TArray<FTagValueModifier> Modifiers;
+
+        /** Aggregate of the modifiers over the base value, only meaningful if the tag had a numeric base value */
+        mutable float CachedValue = 0.f;
+        mutable bool bCachedHasBaseValue = false;
+        mutable bool bDirty = true;
+    };
+
+    /** Gets the numeric base value of a tag, false if it has none */
+    bool GetNumericBaseValue(FGameplayTag Tag, const AActor* ScopeActor, float& OutValue) const;
+
+    /** Marks the aggregate of the tag dirty, or of every tag if the tag is invalid */
+    void MarkModifiedValueDirty(FGameplayTag Tag);
+
+    /** Removes the modifiers matching the predicate and marks their stacks dirty. Returns the number of modifiers removed. */
+    template<typename PredicateType>
+    int32 RemoveValueModifiersIf(PredicateType&& Predicate);
+
+    TMap<FGameplayTag, FTagValueModifierStack> ModifierStacks;
+    TMap<FTagValueModifierHandle, FGameplayTag> ModifierTags;
+    int32 NextModifierId = 0;
+
+    /** Listeners of value changes, of a single tag or of a tag and its children */
+    TMap<FGameplayTag, FOnTagValueChanged> ExactTagValueChangedEvents;
+    TMap<FGameplayTag, FOnTagValueChanged> ChildTagValueChangedEvents;
+
+    /** Last effective value delivered for every watched tag that has a value */
+    TMap<FGameplayTag, FInstancedStruct> NotifiedTagValues;
+
+    /** Changes waiting for the next flush */
+    TSet<FGameplayTag> PendingTagValueChanges;
+    bool bPendingAllTagValuesChanged = false;
+    FTSTicker::FDelegateHandle TagValueFlushHandle;
+
+    /** Marks the tag as changed since the last published snapshot, or every tag if it is invalid */
+    void MarkReadSnapshotDirty(FGameplayTag Tag);
+
+    /** Publishes the pending writes on the next tick of the core ticker. Returns false to remove the ticker. */
+    bool HandlePublishReadSnapshot(float DeltaTime);
+
+    /** Latest published snapshot, only swapped under the lock so readers always copy a whole pointer */
+    FTagValueSnapshotPtr ReadSnapshot;
+    mutable FRWLock ReadSnapshotLock;
+
+    /** Tags changed since the last published snapshot */
+    TSet<FGameplayTag> DirtySnapshotTags;
+    bool bReadSnapshotFullyDirty = true;
+    FTSTicker::FDelegateHandle ReadSnapshotPublishHandle;
+
+    /** Tags changed since the flattened view was last updated, read from their repositories until then */
+    TSet<FGameplayTag> DirtyFlattenedTags;
+    bool bFlattenedViewFullyDirty = true;
+    FTSTicker::FDelegateHandle FlattenedViewUpdateHandle;
 
 private:
+    /** Global repositories, visible to every query. */
     UPROPERTY()
     TArray<TScriptInterface<ITagValueRepository>> Repositories;
 
+    /** Objects of the global repositories, for constant time membership checks. Keyed with the object serial so a new object reusing a freed address is not mistaken for a registered one. */
+    TSet<TObjectKey<UObject>> RepositoryObjects;
+
+    /** Repositories only visible to queries made with their actor as context, so lookups don't depend on world population. */
+    UPROPERTY()
+    TMap<TObjectPtr<AActor>, FTagValueRepositoryList> ScopedRepositories;
+
     /** Default in-memory repository managed by the subsystem. This is always present. */
-    TSharedPtr<FMemoryTagValueRepository> DefaultRepositoryInternal;
+    TSharedPtr<ITagValueRepository> DefaultRepositoryInternal;
+
+    /** The default repository when it stores typed columns, owned by DefaultRepositoryInternal. Used by the scalar accessors. */
+    FColumnarTagValueRepository* ColumnarDefaultRepository = nullptr;
 
     // Configuration for the default internal repository
     UPROPERTY(Config, EditAnywhere, Category = "Default Repository")
@@ -133,4 +594,20 @@ private:
 
     UPROPERTY(Config, EditAnywhere, Category = "Default Repository")
     int32 DefaultInternalRepositoryPriority = 0; // Typically a lower priority
+
+    /** Store the default repository in typed columns (see FColumnarTagValueRepository), for large sets of scalar values. */
+    UPROPERTY(Config, EditAnywhere, Category = "Default Repository")
+    bool bUseColumnarDefaultRepository = false;
+
+    /** Serve reads from a flattened merge of the global repositories, for read-heavy games. */
+    UPROPERTY(Config, EditAnywhere, Category = "Flattened View")
+    bool bUseFlattenedView = false;
+
+    /** Let tags without a value inherit the value of their ancestor categories. */
+    UPROPERTY(Config, EditAnywhere, Category = "Inheritance")
+    bool bUseValueInheritance = false;
+
+    /** Publish a read snapshot so other threads can read values. */
+    UPROPERTY(Config, EditAnywhere, Category = "Concurrent Reads")
+    bool bEnableConcurrentReads = false;
 };
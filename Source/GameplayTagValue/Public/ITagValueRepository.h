@@ -6,8 +6,64 @@
 #include "GameplayTagContainer.h"
 #include "UObject/Interface.h"
 #include "StructUtils/InstancedStruct.h"
+#include "StructUtils/StructView.h"
 #include "ITagValueRepository.generated.h"
 
+class ITagValueRepository;
+
+/**
+ * Read-only view of a value stored in a tag value repository, nothing is copied.
+ * Only valid until the next mutation of that repository: in builds with checks, reading a stale view asserts.
+ */
+struct GAMEPLAYTAGVALUE_API FTagValueView
+{
+    FTagValueView() = default;
+    FTagValueView(const ITagValueRepository& InRepository, const FInstancedStruct& InValue);
+
+    /** Whether the view points to a value */
+    bool IsValid() const { return Value != nullptr; }
+
+    /** Gets the type of the value, nullptr for an empty view */
+    const UScriptStruct* GetScriptStruct() const
+    {
+        CheckNotStale();
+        return Value ? Value->GetScriptStruct() : nullptr;
+    }
+
+    /** Gets the value as a struct view */
+    FConstStructView Get() const
+    {
+        CheckNotStale();
+        return Value ? FConstStructView(Value->GetScriptStruct(), Value->GetMemory()) : FConstStructView();
+    }
+
+    /** Gets the value if it is of type T */
+    template<typename T>
+    const T* GetPtr() const
+    {
+        CheckNotStale();
+        return Value && Value->GetScriptStruct()->IsChildOf(T::StaticStruct()) ? Value->GetPtr<T>() : nullptr;
+    }
+
+private:
+    void CheckNotStale() const;
+
+    const FInstancedStruct* Value = nullptr;
+#if DO_CHECK
+    /** Version counter of the repository, weak so the check stays safe once the repository is destroyed. Unset if the repository shares none. */
+    TWeakPtr<const uint32> RepositoryVersionCounter;
+    uint32 RepositoryVersion = 0;
+    FName RepositoryName;
+    bool bCheckVersion = false;
+#endif
+};
+
+/**
+ * Broadcast by a repository whenever its values change.
+ * The tag is invalid when any number of values changed at once (e.g. ClearAllValues).
+ */
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnTagValueRepositoryChanged, ITagValueRepository& /*Repository*/, FGameplayTag /*Tag*/);
+
 UINTERFACE(MinimalAPI, Blueprintable)
 class UTagValueRepository : public UInterface
 {
@@ -34,6 +90,21 @@ public:
      */
     virtual void SetValue(FGameplayTag Tag, const FInstancedStruct& InValue) = 0;
 
+    /**
+     * Sets the values of several tags at once. Implementations should reserve their storage once for the whole batch
+     * and report the changed tags once every value is stored, see SetValuesBatched.
+     * @param Tags The tags to associate the values with.
+     * @param InValues The values to set, one per tag.
+     */
+    virtual void SetValues(TConstArrayView<FGameplayTag> Tags, TConstArrayView<FInstancedStruct> InValues)
+    {
+        check(Tags.Num() == InValues.Num());
+        for (int32 Index = 0; Index < Tags.Num(); ++Index)
+        {
+            SetValue(Tags[Index], InValues[Index]);
+        }
+    }
+
     /**
      * Checks if a value is associated with the given tag.
      * @param Tag The tag to query.
@@ -64,18 +135,63 @@ public:
      */
     virtual int32 GetRepositoryPriority() const = 0;
 
+    /**
+     * Gets the version of this repository, incremented on every mutation.
+     * Pointers returned by FindValue are only valid as long as the version doesn't change.
+     * @return The version of the repository.
+     */
+    virtual uint32 GetRepositoryVersion() const = 0;
+
+    /**
+     * Finds the value associated with the given tag without copying it.
+     * @param Tag The tag to query.
+     * @return Pointer to the stored value, or nullptr if there is no valid value. Invalidated by the next mutation of the repository.
+     */
+    virtual const FInstancedStruct* FindValue(FGameplayTag Tag) const = 0;
+
+    /**
+     * Appends every tag that has a valid value in this repository.
+     * @param OutTags The array to append the tags to.
+     */
+    virtual void GetAllTags(TArray<FGameplayTag>& OutTags) const = 0;
+
+    /**
+     * Gets the delegate broadcast whenever a value of this repository changes.
+     * @return The change delegate of the repository.
+     */
+    virtual FOnTagValueRepositoryChanged& OnRepositoryChanged() = 0;
+
+    /**
+     * Gets the counter behind GetRepositoryVersion, shared so views can detect they are stale even after the repository is destroyed.
+     * Repositories that return none are not checked by views.
+     */
+    virtual TSharedPtr<const uint32> GetRepositoryVersionCounter() const { return nullptr; }
+
+    /**
+     * Gets a view of the value associated with the given tag, pointing directly into the repository storage.
+     * The view is invalidated by the next mutation of this repository, which is asserted in builds with checks.
+     */
+    FTagValueView GetValueView(FGameplayTag Tag) const;
+
+    /**
+     * Gets a pointer to the value associated with the given tag if it is of type T, pointing directly into the repository storage.
+     * The pointer is invalidated by the next mutation of this repository.
+     */
+    template<typename T>
+    const T* GetValuePtr(FGameplayTag Tag) const
+    {
+        const FInstancedStruct* Value = FindValue(Tag);
+        return Value && Value->GetScriptStruct()->IsChildOf(T::StaticStruct()) ? Value->GetPtr<T>() : nullptr;
+    }
+
     // Templated helper to get a specific struct type
     template<typename T>
     bool GetValue(FGameplayTag Tag, T& OutValue) const
     {
-        FInstancedStruct InstancedStruct;
-        if (GetValue(Tag, InstancedStruct))
+        if (const T* Value = GetValuePtr<T>(Tag))
         {
-            if (InstancedStruct.IsValid() && InstancedStruct.GetScriptStruct()->IsChildOf(T::StaticStruct()))
-            {
-                OutValue = *InstancedStruct.GetPtr<T>();
-                return true;
-            }
+            OutValue = *Value;
+            return true;
         }
         return false;
     }
@@ -88,4 +204,74 @@ public:
         InstancedStruct.InitializeAs(T::StaticStruct(), reinterpret_cast<const uint8*>(&InValue));
         SetValue(Tag, InstancedStruct);
     }
+
+protected:
+    /**
+     * Shared implementation of SetValues: stores every value with a valid tag, then reports each changed tag.
+     * Listeners are only called once the whole batch is stored, and always with the actual tags: an invalid tag would make
+     * them drop everything they cached about the repository, which is reserved for ClearAllValues.
+     * @param AssignValue Stores one value without notifying, returns true if the repository changed.
+     * @param NotifyChanged Called with each changed tag.
+     */
+    template<typename AssignType, typename NotifyType>
+    static void SetValuesBatched(TConstArrayView<FGameplayTag> Tags, TConstArrayView<FInstancedStruct> InValues, AssignType&& AssignValue, NotifyType&& NotifyChanged)
+    {
+        check(Tags.Num() == InValues.Num());
+        TArray<FGameplayTag, TInlineAllocator<16>> ChangedTags;
+        for (int32 Index = 0; Index < Tags.Num(); ++Index)
+        {
+            if (Tags[Index].IsValid() && AssignValue(Tags[Index], InValues[Index]))
+            {
+                ChangedTags.Add(Tags[Index]);
+            }
+        }
+
+        for (const FGameplayTag& ChangedTag : ChangedTags)
+        {
+            NotifyChanged(ChangedTag);
+        }
+    }
+
+    /** SetValuesBatched for repositories storing their values in a map, reserved once for the whole batch */
+    template<typename MapType, typename NotifyType>
+    static void SetValuesInMap(MapType& Storage, TConstArrayView<FGameplayTag> Tags, TConstArrayView<FInstancedStruct> InValues, NotifyType&& NotifyChanged)
+    {
+        Storage.Reserve(Storage.Num() + Tags.Num());
+        SetValuesBatched(Tags, InValues, [&Storage](FGameplayTag Tag, const FInstancedStruct& InValue)
+        {
+            Storage.Emplace(Tag, InValue);
+            return true;
+        }, Forward<NotifyType>(NotifyChanged));
+    }
 };
+
+inline FTagValueView::FTagValueView(const ITagValueRepository& InRepository, const FInstancedStruct& InValue)
+    : Value(&InValue)
+{
+#if DO_CHECK
+    const TSharedPtr<const uint32> VersionCounter = InRepository.GetRepositoryVersionCounter();
+    RepositoryVersionCounter = VersionCounter;
+    RepositoryVersion = VersionCounter.IsValid() ? *VersionCounter : 0;
+    RepositoryName = InRepository.GetRepositoryName();
+    bCheckVersion = VersionCounter.IsValid();
+#endif
+}
+
+inline void FTagValueView::CheckNotStale() const
+{
+#if DO_CHECK
+    if (Value && bCheckVersion)
+    {
+        // Never touches the repository itself, which may be gone
+        const TSharedPtr<const uint32> VersionCounter = RepositoryVersionCounter.Pin();
+        checkf(VersionCounter.IsValid(), TEXT("Tag value view read after its repository '%s' was destroyed."), *RepositoryName.ToString());
+        checkf(*VersionCounter == RepositoryVersion, TEXT("Tag value view read after its repository '%s' was modified."), *RepositoryName.ToString());
+    }
+#endif
+}
+
+inline FTagValueView ITagValueRepository::GetValueView(FGameplayTag Tag) const
+{
+    const FInstancedStruct* Value = FindValue(Tag);
+    return Value ? FTagValueView(*this, *Value) : FTagValueView();
+}
@@ -27,13 +27,25 @@ public:
     //~ Begin ITagValueRepository Interface
     virtual bool GetValue(FGameplayTag Tag, FInstancedStruct& OutValue) const override;
     virtual void SetValue(FGameplayTag Tag, const FInstancedStruct& InValue) override;
+    virtual void SetValues(TConstArrayView<FGameplayTag> Tags, TConstArrayView<FInstancedStruct> InValues) override;
     virtual bool HasValue(FGameplayTag Tag) const override;
     virtual void ClearValue(FGameplayTag Tag) override;
     virtual void ClearAllValues() override;
     virtual FName GetRepositoryName() const override;
     virtual int32 GetRepositoryPriority() const override;
+    virtual uint32 GetRepositoryVersion() const override;
+    virtual TSharedPtr<const uint32> GetRepositoryVersionCounter() const override;
+    virtual const FInstancedStruct* FindValue(FGameplayTag Tag) const override;
+    virtual void GetAllTags(TArray<FGameplayTag>& OutTags) const override;
+    virtual FOnTagValueRepositoryChanged& OnRepositoryChanged() override;
     //~ End ITagValueRepository Interface
 
+#if WITH_EDITOR
+    //~ Begin UObject Interface
+    virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+    //~ End UObject Interface
+#endif
+
     /** Sets a value directly in this component's storage. The input struct type is determined by what you connect to 'Value'. */
     UFUNCTION(BlueprintCallable, Category = "GameplayTagValue|Component", meta = (DisplayName = "Set Component Tag Value (Instanced)", AutoCreateRefTerm = "Tag,Value"))
     void SetComponentTagValue(FGameplayTag Tag, const FInstancedStruct& Value);
@@ -46,27 +58,48 @@ public:
     UFUNCTION(BlueprintPure, Category = "GameplayTagValue|Component", meta=(AutoCreateRefTerm = "Tag"))
     bool HasComponentTagValue(FGameplayTag Tag) const;
 
+    /** Sets the priority of this repository, reordering it in the subsystem if it is registered. */
+    UFUNCTION(BlueprintCallable, Category = "GameplayTagValue|Component")
+    void SetPriority(int32 NewPriority);
+
 public:
     /** Name of this repository, used for identification by the subsystem. If None, a unique name will be generated. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GameplayTagValue")
     FName RepositoryName;
 
-    /** Priority of this repository. Higher values are checked first by the subsystem. */
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GameplayTagValue")
+    /** Priority of this repository. Higher values are checked first by the subsystem. Change it through SetPriority once registered. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, BlueprintSetter = SetPriority, Category = "GameplayTagValue")
     int32 Priority;
 
     /** If true, this component will automatically register itself with the GameplayTagValueSubsystem on BeginPlay. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GameplayTagValue")
     bool bRegisterWithSubsystemOnBeginPlay;
 
+    /**
+     * If true, this component registers as a global repository visible to every query (e.g. on a game state).
+     * Otherwise it is scoped to its owner and only resolved by queries made with the owner as context.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GameplayTagValue")
+    bool bRegisterAsGlobalRepository;
+
 protected:
-    /** The actual storage for tag values. Exposed to editor for pre-configuration. */
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GameplayTagValue", meta = (DisplayName = "Tag Values Storage"))
+    /** The actual storage for tag values. Exposed to editor for pre-configuration, written through SetValue at runtime so the version is bumped. */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "GameplayTagValue", meta = (DisplayName = "Tag Values Storage"))
     TMap<FGameplayTag, FInstancedStruct> ComponentTagValues;
 
 private:
+    /** Bumps the version and notifies listeners. An invalid tag means every value may have changed. */
+    void NotifyChanged(FGameplayTag Tag);
+
+    /** Shared with the views into this repository, see GetRepositoryVersionCounter */
+    TSharedRef<uint32> Version = MakeShared<uint32>(0);
+    FOnTagValueRepositoryChanged RepositoryChangedDelegate;
+
     void TryRegisterWithSubsystem();
     void TryUnregisterFromSubsystem();
     
     bool bIsRegisteredWithSubsystem;
+
+    /** Whether the current registration is global, the flag may have changed since */
+    bool bIsRegisteredAsGlobal;
 };
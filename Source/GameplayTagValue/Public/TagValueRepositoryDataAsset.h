@@ -24,13 +24,25 @@ public:
     //~ Begin ITagValueRepository Interface
     virtual bool GetValue(FGameplayTag Tag, FInstancedStruct& OutValue) const override;
     virtual void SetValue(FGameplayTag Tag, const FInstancedStruct& InValue) override;
+    virtual void SetValues(TConstArrayView<FGameplayTag> Tags, TConstArrayView<FInstancedStruct> InValues) override;
     virtual bool HasValue(FGameplayTag Tag) const override;
     virtual void ClearValue(FGameplayTag Tag) override;
     virtual void ClearAllValues() override;
     virtual FName GetRepositoryName() const override;
     virtual int32 GetRepositoryPriority() const override;
+    virtual uint32 GetRepositoryVersion() const override;
+    virtual TSharedPtr<const uint32> GetRepositoryVersionCounter() const override;
+    virtual const FInstancedStruct* FindValue(FGameplayTag Tag) const override;
+    virtual void GetAllTags(TArray<FGameplayTag>& OutTags) const override;
+    virtual FOnTagValueRepositoryChanged& OnRepositoryChanged() override;
     //~ End ITagValueRepository Interface
 
+#if WITH_EDITOR
+    //~ Begin UObject Interface
+    virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+    //~ End UObject Interface
+#endif
+
     /** Sets a value directly in this data asset's storage. The input struct type is determined by what you connect to 'Value'. */
     UFUNCTION(BlueprintCallable, Category = "GameplayTagValue|DataAsset", meta = (DisplayName = "Set Data Asset Tag Value (Instanced)", AutoCreateRefTerm = "Tag,Value"))
     void SetDataAssetTagValue(FGameplayTag Tag, const FInstancedStruct& Value);
@@ -56,7 +68,7 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GameplayTagValue")
     FName RepositoryName;
 
-    /** Priority of this repository. Higher values are checked first by the subsystem. */
+    /** Priority of this repository. Higher values are checked first by the subsystem. After changing it on a registered asset, call UGameplayTagValueSubsystem::NotifyRepositoryPriorityChanged. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GameplayTagValue")
     int32 Priority;
 
@@ -65,10 +77,17 @@ public:
     bool bAutoRegisterWithSubsystem;
 
 protected:
-    /** The actual storage for tag values. Exposed to editor for configuration. */
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GameplayTagValue", meta = (DisplayName = "Tag Values Storage"))
+    /** The actual storage for tag values. Exposed to editor for configuration, written through SetValue at runtime so the version is bumped. */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "GameplayTagValue", meta = (DisplayName = "Tag Values Storage"))
     TMap<FGameplayTag, FInstancedStruct> DataAssetTagValues;
 
 private:
+    /** Bumps the version and notifies listeners. An invalid tag means every value may have changed. */
+    void NotifyChanged(FGameplayTag Tag);
+
+    /** Shared with the views into this repository, see GetRepositoryVersionCounter */
+    TSharedRef<uint32> Version = MakeShared<uint32>(0);
+    FOnTagValueRepositoryChanged RepositoryChangedDelegate;
+
     bool bIsRegisteredWithSubsystem;
 };
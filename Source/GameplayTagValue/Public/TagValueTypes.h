@@ -0,0 +1,75 @@
+// Copyright Nguyen Phi Hung 2025. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "TagValueTypes.generated.h"
+
+/**
+ * Wrappers for the scalar values most tags carry.
+ * Repositories that know these types (e.g. FColumnarTagValueRepository) store them without going through reflection.
+ */
+
+USTRUCT(BlueprintType)
+struct GAMEPLAYTAGVALUE_API FTagValueFloat
+{
+    GENERATED_BODY()
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GameplayTagValue")
+    float Value = 0.f;
+};
+
+USTRUCT(BlueprintType)
+struct GAMEPLAYTAGVALUE_API FTagValueInt
+{
+    GENERATED_BODY()
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GameplayTagValue")
+    int32 Value = 0;
+};
+
+USTRUCT(BlueprintType)
+struct GAMEPLAYTAGVALUE_API FTagValueBool
+{
+    GENERATED_BODY()
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GameplayTagValue")
+    bool Value = false;
+};
+
+USTRUCT(BlueprintType)
+struct GAMEPLAYTAGVALUE_API FTagValueVector
+{
+    GENERATED_BODY()
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GameplayTagValue")
+    FVector Value = FVector::ZeroVector;
+};
+
+/** How a modifier combines with the value it is applied to */
+UENUM(BlueprintType)
+enum class ETagValueModifierOp : uint8
+{
+    /** Adds the magnitude to the value */
+    Add,
+    /** Multiplies the value by the magnitude */
+    Multiply,
+    /** Replaces the value with the magnitude */
+    Override
+};
+
+/** Identifies a modifier added to a tag value, to remove it later */
+USTRUCT(BlueprintType)
+struct GAMEPLAYTAGVALUE_API FTagValueModifierHandle
+{
+    GENERATED_BODY()
+
+    bool IsValid() const { return Id != INDEX_NONE; }
+
+    bool operator==(const FTagValueModifierHandle& Other) const { return Id == Other.Id; }
+
+    friend uint32 GetTypeHash(const FTagValueModifierHandle& Handle) { return ::GetTypeHash(Handle.Id); }
+
+    UPROPERTY()
+    int32 Id = INDEX_NONE;
+};